@@ -0,0 +1,23 @@
+#pragma once
+
+#include <boost/asio.hpp>
+
+namespace pgl {
+	/*
+	 * An I/O context run by one thread needs no locking between its handlers. It skips a part of internal synchronization
+	 * with concurrency hint 1, and handlers on it are already serialized without a strand.
+	 */
+
+	// Get a concurrency hint to construct an I/O context.
+	inline int get_io_context_concurrency_hint(const bool is_io_context_run_by_one_thread) {
+		return is_io_context_run_by_one_thread ? 1 : BOOST_ASIO_CONCURRENCY_HINT_DEFAULT;
+	}
+
+	// Get an executor which serializes handlers of one session or operation on an I/O context.
+	template <typename Executor>
+	boost::asio::any_io_executor make_serialized_executor(const Executor& executor,
+		const bool is_io_context_run_by_one_thread) {
+		if (is_io_context_run_by_one_thread) { return executor; }
+		return boost::asio::make_strand(executor);
+	}
+}
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <boost/asio.hpp>
-#include <boost/asio/spawn.hpp>
 
 #include "utilities/pack.hpp"
 #include "utilities/concepts.hpp"
@@ -9,23 +8,24 @@
 
 namespace pgl {
 	/*
-	 * Send multi serializable data in one communication
+	 * Queue multi serializable data to send in one communication with other queued data
+	 * Data is serialized on the stack, so this does not allocate once the send queue has grown to the size of a batch.
 	 */
 	template <serializable... Data>
-	void packed_async_write(client_connection& connection, boost::asio::yield_context yield,
-		const Data& ... data) {
-		auto buffer = pack_data(data...);
-		connection.async_write(boost::asio::buffer(buffer), yield);
+	void packed_queue_write(client_connection& connection, const Data& ... data) {
+		const auto buffer = pack_data_to_array(data...);
+		connection.queue_write(buffer);
 	}
 
 	/*
 	 * Receive multi serializable data in one communication
+	 * Data is deserialized in place from the receive buffer of the connection, which may already hold it by a previous read.
 	 */
 	template <typename... Data> requires(serializable_all<Data...> && not_constant_all<Data...>)
-	void unpacked_async_read(client_connection& connection, boost::asio::yield_context yield, Data& ... data) {
+	boost::asio::awaitable<void> unpacked_async_read(client_connection& connection, Data& ... data) {
 		constexpr auto total_size = get_packed_size<Data...>();
-		std::vector<uint8_t> buffer(total_size);
-		connection.async_read(boost::asio::buffer(buffer), boost::asio::transfer_exactly(total_size), yield);
-		unpack_data(buffer, data...);
+		const auto received_data = co_await connection.async_receive(total_size);
+		unpack_data(received_data.first(total_size), data...);
+		connection.consume_received_data(total_size);
 	}
 }
@@ -2,17 +2,35 @@
 
 #include <atomic>
 #include <chrono>
-#include <functional>
+#include <concepts>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include <boost/asio.hpp>
 
+#include "timer_wheel.hpp"
+
 namespace pgl {
 	// The executor must serialize this timer handler with socket operations, normally by constructing the socket
-	// with a strand. This keeps cancel() ordered with the yielding async operation.
-	template <class SocketLike, typename... TimeParams>
-	void execute_socket_timed_async_operation(SocketLike& socket,
-		const std::chrono::duration<TimeParams...>& time, std::function<void()>&& proc) {
+	// with a strand. This keeps cancel() ordered with the awaited async operation.
+	// The operation is taken as an awaitable rather than a function object because an awaitable does not start until it is awaited.
+	// If the socket has a timer wheel, its intrusive deadline is armed instead of a new timer. This does not allocate.
+	template <class SocketLike, typename T, typename... TimeParams>
+	boost::asio::awaitable<T> execute_socket_timed_async_operation(SocketLike& socket,
+		const std::chrono::duration<TimeParams...>& time, boost::asio::awaitable<T> operation) {
+		if constexpr (requires { { socket.deadline_wheel() } -> std::convertible_to<timer_wheel*>; }) {
+			if (auto* const wheel = socket.deadline_wheel()) {
+				const timer_wheel_deadline_guard deadline_guard(*wheel, socket.deadline(),
+					std::chrono::duration_cast<std::chrono::steady_clock::duration>(time));
+				if constexpr (std::is_void_v<T>) {
+					co_await std::move(operation);
+					co_return;
+				}
+				else { co_return co_await std::move(operation); }
+			}
+		}
+
 		boost::asio::steady_timer timer(socket.get_executor());
 		timer.expires_after(time);
 		auto is_operation_finished = std::make_shared<std::atomic_bool>(false);
@@ -34,12 +52,20 @@ namespace pgl {
 			}
 		};
 
-		try { proc(); }
+		try {
+			if constexpr (std::is_void_v<T>) {
+				co_await std::move(operation);
+				finish_timer();
+			}
+			else {
+				auto result = co_await std::move(operation);
+				finish_timer();
+				co_return result;
+			}
+		}
 		catch (const boost::system::system_error&) {
 			finish_timer();
 			throw;
 		}
-
-		finish_timer();
 	}
 }
@@ -0,0 +1,133 @@
+#include "timer_wheel.hpp"
+
+#include <stdexcept>
+
+using namespace boost;
+
+namespace pgl {
+	timer_wheel_deadline::timer_wheel_deadline(const expire_handler handler, void* const context):
+		handler_(handler), context_(context) {}
+
+	timer_wheel_deadline::~timer_wheel_deadline() {
+		if (wheel_) { wheel_->disarm(*this); }
+	}
+
+	bool timer_wheel_deadline::is_armed() const { return wheel_ != nullptr; }
+
+	timer_wheel::timer_wheel(asio::any_io_executor executor, const std::chrono::steady_clock::duration tick,
+		const size_t slot_count): ticker_(std::move(executor)), tick_(tick) {
+		if (tick <= std::chrono::steady_clock::duration::zero()) {
+			throw std::invalid_argument("Tick of timer_wheel must be positive.");
+		}
+		if (slot_count == 0) { throw std::invalid_argument("Slot count of timer_wheel must be greater than 0."); }
+		heads_.resize(slot_count + 1, nullptr);
+	}
+
+	timer_wheel::~timer_wheel() {
+		for (auto&& head : heads_) {
+			while (head) { unlink(*head); }
+		}
+	}
+
+	void timer_wheel::arm(timer_wheel_deadline& deadline, const std::chrono::steady_clock::duration timeout) {
+		if (deadline.wheel_) { deadline.wheel_->disarm(deadline); }
+
+		if (!is_ticking_) {
+			is_ticking_ = true;
+			ticker_.expires_after(tick_);
+			wait_next_tick();
+		}
+
+		// Count ticks from the next tick so that the deadline does not expire before its time.
+		const auto time_to_next_tick = ticker_.expiry() - std::chrono::steady_clock::now();
+		const auto time_after_next_tick = timeout - time_to_next_tick;
+		uint64_t tick_count = 1;
+		if (time_after_next_tick > std::chrono::steady_clock::duration::zero()) {
+			tick_count += (time_after_next_tick + tick_ - std::chrono::steady_clock::duration(1)) / tick_;
+		}
+
+		deadline.rounds_ = (tick_count - 1) / slot_count();
+		link(deadline, (cursor_ + tick_count) % slot_count());
+		deadline.wheel_ = this;
+		++armed_count_;
+	}
+
+	void timer_wheel::disarm(timer_wheel_deadline& deadline) {
+		if (deadline.wheel_ != this) { return; }
+		unlink(deadline);
+		--armed_count_;
+	}
+
+	size_t timer_wheel::armed_count() const { return armed_count_; }
+
+	std::chrono::steady_clock::duration timer_wheel::tick() const { return tick_; }
+
+	size_t timer_wheel::slot_count() const { return heads_.size() - 1; }
+
+	size_t timer_wheel::expired_list_index() const { return heads_.size() - 1; }
+
+	void timer_wheel::link(timer_wheel_deadline& deadline, const size_t list_index) {
+		auto& head = heads_[list_index];
+		deadline.slot_ = list_index;
+		deadline.previous_ = nullptr;
+		deadline.next_ = head;
+		if (head) { head->previous_ = &deadline; }
+		head = &deadline;
+	}
+
+	void timer_wheel::unlink(timer_wheel_deadline& deadline) {
+		if (deadline.previous_) { deadline.previous_->next_ = deadline.next_; }
+		else { heads_[deadline.slot_] = deadline.next_; }
+		if (deadline.next_) { deadline.next_->previous_ = deadline.previous_; }
+		deadline.previous_ = nullptr;
+		deadline.next_ = nullptr;
+		deadline.wheel_ = nullptr;
+	}
+
+	void timer_wheel::wait_next_tick() {
+		ticker_.async_wait([weak_this = weak_from_this()](const system::error_code& error_code) {
+			if (error_code) { return; }
+			if (const auto shared_this = weak_this.lock()) { shared_this->advance(); }
+		});
+	}
+
+	void timer_wheel::advance() {
+		cursor_ = (cursor_ + 1) % slot_count();
+		// Set the next tick before calling handlers because arm() counts ticks from it.
+		ticker_.expires_at(ticker_.expiry() + tick_);
+
+		// Move expired deadlines to the expired list first because a handler may arm or disarm other deadlines.
+		auto* deadline = heads_[cursor_];
+		while (deadline) {
+			auto* const next = deadline->next_;
+			if (deadline->rounds_ == 0) {
+				unlink(*deadline);
+				link(*deadline, expired_list_index());
+				deadline->wheel_ = this;
+			}
+			else { --deadline->rounds_; }
+			deadline = next;
+		}
+
+		while (auto* const expired = heads_[expired_list_index()]) {
+			unlink(*expired);
+			--armed_count_;
+			expired->handler_(expired->context_);
+		}
+
+		// Stop ticking while no deadline is armed so that an idle thread is not woken up.
+		if (armed_count_ == 0) {
+			is_ticking_ = false;
+			return;
+		}
+
+		wait_next_tick();
+	}
+
+	timer_wheel_deadline_guard::timer_wheel_deadline_guard(timer_wheel& wheel, timer_wheel_deadline& deadline,
+		const std::chrono::steady_clock::duration timeout): wheel_(wheel), deadline_(deadline) {
+		wheel_.arm(deadline_, timeout);
+	}
+
+	timer_wheel_deadline_guard::~timer_wheel_deadline_guard() { wheel_.disarm(deadline_); }
+}
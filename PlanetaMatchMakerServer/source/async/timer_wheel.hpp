@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace pgl {
+	class timer_wheel;
+
+	/**
+	 * A deadline which is held by a timer_wheel as an intrusive list node.
+	 * The owner of the deadline keeps it, so arming it does not allocate. It is disarmed on destruction.
+	 */
+	class timer_wheel_deadline final : boost::noncopyable {
+	public:
+		// A handler called on expiry. It must not throw.
+		using expire_handler = void (*)(void* context) noexcept;
+
+		/**
+		 * @param handler A handler called on expiry.
+		 * @param context A context passed to handler.
+		 */
+		timer_wheel_deadline(expire_handler handler, void* context);
+		~timer_wheel_deadline();
+
+		[[nodiscard]] bool is_armed() const;
+
+	private:
+		friend class timer_wheel;
+
+		expire_handler handler_;
+		void* context_;
+		// A wheel which holds this deadline. nullptr if this is not armed.
+		timer_wheel* wheel_ = nullptr;
+		timer_wheel_deadline* previous_ = nullptr;
+		timer_wheel_deadline* next_ = nullptr;
+		size_t slot_ = 0;
+		// The number of times the wheel passes the slot before this expires.
+		uint64_t rounds_ = 0;
+	};
+
+	/**
+	 * A hashed timer wheel which holds deadlines of operations run by one thread.
+	 *
+	 * Arming and disarming a deadline are O(1) and do not allocate. One ticker timer advances the wheel every tick while any deadline is armed, and calls handlers of expired deadlines.
+	 * A deadline expires at its time or up to one tick later.
+	 * This is not thread safe. Deadlines must be armed and disarmed on the thread which runs the executor.
+	 */
+	class timer_wheel final : public std::enable_shared_from_this<timer_wheel>, boost::noncopyable {
+	public:
+		static constexpr size_t default_slot_count = 512;
+
+		/**
+		 * Create a timer wheel. Use std::make_shared because the ticker refers this weakly.
+		 *
+		 * @param executor An executor of the ticker. It must be run by only one thread.
+		 * @param tick An interval to advance the wheel.
+		 * @param slot_count The number of slots. A deadline beyond slot_count ticks is kept with a round count.
+		 * @throw std::invalid_argument tick is not positive or slot_count is 0.
+		 */
+		timer_wheel(boost::asio::any_io_executor executor, std::chrono::steady_clock::duration tick,
+			size_t slot_count = default_slot_count);
+		~timer_wheel();
+
+		/**
+		 * Arm a deadline. If it is already armed, it is rearmed.
+		 *
+		 * @param deadline A deadline to arm.
+		 * @param timeout A time until expiry.
+		 */
+		void arm(timer_wheel_deadline& deadline, std::chrono::steady_clock::duration timeout);
+
+		// Disarm a deadline. Nothing is done if it is not armed by this wheel.
+		void disarm(timer_wheel_deadline& deadline);
+
+		[[nodiscard]] size_t armed_count() const;
+
+		[[nodiscard]] std::chrono::steady_clock::duration tick() const;
+
+	private:
+		boost::asio::steady_timer ticker_;
+		std::chrono::steady_clock::duration tick_;
+		// Heads of deadline lists of slots. The last one is a list of expired deadlines whose handlers are not called yet.
+		std::vector<timer_wheel_deadline*> heads_;
+		size_t cursor_ = 0;
+		size_t armed_count_ = 0;
+		bool is_ticking_ = false;
+
+		[[nodiscard]] size_t slot_count() const;
+		[[nodiscard]] size_t expired_list_index() const;
+		void link(timer_wheel_deadline& deadline, size_t list_index);
+		void unlink(timer_wheel_deadline& deadline);
+		void wait_next_tick();
+		void advance();
+	};
+
+	/**
+	 * Arm a deadline while this is alive.
+	 */
+	class timer_wheel_deadline_guard final : boost::noncopyable {
+	public:
+		timer_wheel_deadline_guard(timer_wheel& wheel, timer_wheel_deadline& deadline,
+			std::chrono::steady_clock::duration timeout);
+		~timer_wheel_deadline_guard();
+
+	private:
+		timer_wheel& wheel_;
+		timer_wheel_deadline& deadline_;
+	};
+}
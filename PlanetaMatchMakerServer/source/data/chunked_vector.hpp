@@ -0,0 +1,208 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace pgl {
+	/**
+	 * A sequence which stores values in chunks of fixed maximum size and shares the chunks between copies.
+	 *
+	 * A copy copies only pointers of chunks, and a modification copies only the chunk which has the modified value, so a modified copy of a large sequence is made in time proportional to the number of chunks and the chunk size instead of the number of values.
+	 * Chunks are never modified after they are shared, so a copy can be read by other threads while the original is modified.
+	 * Iterators are invalidated by any modification.
+	 * This is not thread safe.
+	 *
+	 * @tparam T A type of value.
+	 * @tparam ChunkSize The maximum number of values in one chunk.
+	 */
+	template <typename T, size_t ChunkSize = 128> requires(ChunkSize >= 2)
+	class chunked_vector final {
+		using chunk_type = std::vector<T>;
+		using chunk_container_type = std::vector<std::shared_ptr<const chunk_type>>;
+
+	public:
+		using value_type = T;
+
+		class const_iterator final {
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const T*;
+			using reference = const T&;
+
+			const_iterator() = default;
+
+			reference operator*() const { return (*(*chunks_)[chunk_index_])[value_index_]; }
+
+			pointer operator->() const { return &**this; }
+
+			const_iterator& operator++() {
+				if (++value_index_ == (*chunks_)[chunk_index_]->size()) {
+					++chunk_index_;
+					value_index_ = 0;
+				}
+				return *this;
+			}
+
+			const_iterator operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+			const_iterator& operator--() {
+				if (value_index_ == 0) {
+					--chunk_index_;
+					value_index_ = (*chunks_)[chunk_index_]->size();
+				}
+				--value_index_;
+				return *this;
+			}
+
+			const_iterator operator--(int) {
+				auto copy = *this;
+				--*this;
+				return copy;
+			}
+
+			bool operator==(const const_iterator& other) const {
+				return chunk_index_ == other.chunk_index_ && value_index_ == other.value_index_;
+			}
+
+		private:
+			friend class chunked_vector;
+
+			const chunk_container_type* chunks_ = nullptr;
+			size_t chunk_index_ = 0;
+			size_t value_index_ = 0;
+
+			const_iterator(const chunk_container_type& chunks, const size_t chunk_index, const size_t value_index) :
+				chunks_(&chunks), chunk_index_(chunk_index), value_index_(value_index) {}
+		};
+
+		using iterator = const_iterator;
+
+		[[nodiscard]] size_t size() const { return size_; }
+
+		[[nodiscard]] bool empty() const { return size_ == 0; }
+
+		[[nodiscard]] const_iterator begin() const { return {chunks_, 0, 0}; }
+
+		[[nodiscard]] const_iterator end() const { return {chunks_, chunks_.size(), 0}; }
+
+		/**
+		 * Find the first value which is not less than value in a sequence sorted by compare and projection.
+		 *
+		 * @return An iterator of the found value. end() if all values are less than value.
+		 */
+		template <typename Value, typename Compare = std::ranges::less, typename Projection = std::identity>
+		[[nodiscard]] const_iterator lower_bound(const Value& value, Compare compare = {},
+			Projection projection = {}) const {
+			// Chunks are sorted too, so the chunk is found by the last value of each chunk.
+			const auto chunk_it = std::ranges::partition_point(chunks_,
+				[&](const std::shared_ptr<const chunk_type>& chunk) {
+					return std::invoke(compare, std::invoke(projection, chunk->back()), value);
+				});
+			if (chunk_it == chunks_.end()) { return end(); }
+
+			const auto value_it = std::ranges::lower_bound(**chunk_it, value, compare, projection);
+			return {
+				chunks_, static_cast<size_t>(chunk_it - chunks_.begin()),
+				static_cast<size_t>(value_it - (*chunk_it)->begin())
+			};
+		}
+
+		/**
+		 * Insert a value before position. Only the chunk of position is copied.
+		 *
+		 * @param position An iterator of this sequence.
+		 * @param value A value to insert.
+		 */
+		void insert(const const_iterator position, T value) {
+			if (chunks_.empty()) {
+				chunks_.push_back(std::make_shared<const chunk_type>(1, std::move(value)));
+				++size_;
+				return;
+			}
+
+			// A value at the end is appended to the last chunk.
+			const auto is_end = position.chunk_index_ == chunks_.size();
+			const auto chunk_index = is_end ? chunks_.size() - 1 : position.chunk_index_;
+			const auto& chunk = *chunks_[chunk_index];
+			const auto value_index = is_end ? chunk.size() : position.value_index_;
+			const auto chunk_it = chunk.begin() + static_cast<std::ptrdiff_t>(value_index);
+			auto new_chunk = std::make_shared<chunk_type>();
+			new_chunk->reserve(chunk.size() + 1);
+			new_chunk->insert(new_chunk->end(), chunk.begin(), chunk_it);
+			new_chunk->push_back(std::move(value));
+			new_chunk->insert(new_chunk->end(), chunk_it, chunk.end());
+
+			if (new_chunk->size() > ChunkSize) {
+				const auto middle = new_chunk->begin() + static_cast<std::ptrdiff_t>(new_chunk->size() / 2);
+				auto second_chunk = std::make_shared<const chunk_type>(middle, new_chunk->end());
+				new_chunk->erase(middle, new_chunk->end());
+				chunks_.insert(chunks_.begin() + static_cast<std::ptrdiff_t>(chunk_index) + 1, std::move(second_chunk));
+			}
+
+			chunks_[chunk_index] = std::move(new_chunk);
+			++size_;
+		}
+
+		/**
+		 * Replace the value at position. Only the chunk of position is copied.
+		 *
+		 * @param position An iterator of a value in this sequence.
+		 * @param value A new value.
+		 */
+		void replace(const const_iterator position, T value) {
+			assert(position != end());
+			auto new_chunk = std::make_shared<chunk_type>(*chunks_[position.chunk_index_]);
+			(*new_chunk)[position.value_index_] = std::move(value);
+			chunks_[position.chunk_index_] = std::move(new_chunk);
+		}
+
+		/**
+		 * Erase the value at position. Only the chunk of position and its next chunk are copied.
+		 *
+		 * @param position An iterator of a value in this sequence.
+		 */
+		void erase(const const_iterator position) {
+			assert(position != end());
+			const auto chunk_index = position.chunk_index_;
+			const auto& chunk = *chunks_[chunk_index];
+			const auto chunk_it = chunk.begin() + static_cast<std::ptrdiff_t>(position.value_index_);
+			--size_;
+			if (chunk.size() == 1) {
+				chunks_.erase(chunks_.begin() + static_cast<std::ptrdiff_t>(chunk_index));
+				return;
+			}
+
+			auto new_chunk = std::make_shared<chunk_type>();
+			const auto next_chunk_index = chunk_index + 1;
+			// Merge a small chunk with the next one so erasing does not leave many small chunks.
+			const auto is_merged = next_chunk_index < chunks_.size() && chunk.size() - 1 + chunks_[next_chunk_index]
+				->size() <= ChunkSize / 2;
+			new_chunk->reserve(chunk.size() - 1 + (is_merged ? chunks_[next_chunk_index]->size() : 0));
+			new_chunk->insert(new_chunk->end(), chunk.begin(), chunk_it);
+			new_chunk->insert(new_chunk->end(), std::next(chunk_it), chunk.end());
+			if (is_merged) {
+				const auto& next_chunk = *chunks_[next_chunk_index];
+				new_chunk->insert(new_chunk->end(), next_chunk.begin(), next_chunk.end());
+				chunks_.erase(chunks_.begin() + static_cast<std::ptrdiff_t>(next_chunk_index));
+			}
+
+			chunks_[chunk_index] = std::move(new_chunk);
+		}
+
+	private:
+		// No chunk is empty.
+		chunk_container_type chunks_;
+		size_t size_ = 0;
+	};
+}
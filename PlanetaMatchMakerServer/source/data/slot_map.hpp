@@ -0,0 +1,258 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pgl {
+	/**
+	 * A position of a value in slot_map.
+	 */
+	struct slot_location final {
+		uint32_t index;
+		// Counted up every time the value in the slot is erased.
+		uint32_t generation;
+	};
+
+	template <class T, typename Key>
+	concept slot_map_key_codec = requires(const T& codec, const Key& key, const slot_location& location)
+	{
+		{ codec.encode(location) } -> std::convertible_to<Key>;
+		{ codec.decode(key) } -> std::convertible_to<slot_location>;
+		{ codec.max_slot_count() } -> std::convertible_to<size_t>;
+	};
+
+	/**
+	 * A map which stores values in a dense array of slots and issues keys of new values by itself.
+	 *
+	 * A key is encoded from the index and the generation of a slot by KeyCodec, so finding a value is an array access.
+	 * The generation of a slot is counted up when its value is erased, so a key of an erased value does not find a value which is added to the same slot later.
+	 * The interface follows std::unordered_map so this can be the storage of basic_thread_safe_data_container, but keys of new values must be taken from next_key().
+	 * This is not thread safe.
+	 *
+	 * @tparam Key A type of key.
+	 * @tparam Value A type of value.
+	 * @tparam KeyCodec A type to convert between a key and a slot location.
+	 */
+	template <typename Key, typename Value, slot_map_key_codec<Key> KeyCodec>
+	class slot_map final {
+		struct slot final {
+			uint32_t generation = 0;
+			std::optional<std::pair<const Key, Value>> entry;
+		};
+
+		using slot_container_type = std::vector<slot>;
+
+		template <bool IsConst>
+		class iterator_base final {
+			using slot_iterator = std::conditional_t<IsConst, typename slot_container_type::const_iterator, typename
+				slot_container_type::iterator>;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = std::pair<const Key, Value>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+			using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+			iterator_base() = default;
+
+			iterator_base(const slot_iterator it, const slot_iterator end) : it_(it), end_(end) { skip_empty_slots(); }
+
+			// NOLINTNEXTLINE(google-explicit-constructor)
+			operator iterator_base<true>() const requires(!IsConst) { return {it_, end_}; }
+
+			reference operator*() const { return *it_->entry; }
+
+			pointer operator->() const { return &*it_->entry; }
+
+			iterator_base& operator++() {
+				++it_;
+				skip_empty_slots();
+				return *this;
+			}
+
+			iterator_base operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+			bool operator==(const iterator_base& other) const { return it_ == other.it_; }
+
+		private:
+			friend class slot_map;
+
+			slot_iterator it_;
+			slot_iterator end_;
+
+			void skip_empty_slots() { while (it_ != end_ && !it_->entry.has_value()) { ++it_; } }
+		};
+
+	public:
+		using key_type = Key;
+		using mapped_type = Value;
+		using value_type = std::pair<const Key, Value>;
+		using iterator = iterator_base<false>;
+		using const_iterator = iterator_base<true>;
+
+		explicit slot_map(KeyCodec key_codec = KeyCodec()) : key_codec_(std::move(key_codec)) {}
+
+		/**
+		 * Get the key which the next added value must have.
+		 *
+		 * @return The key of the next value.
+		 * @throw std::length_error All slots which KeyCodec can encode are used.
+		 */
+		[[nodiscard]] Key next_key() const {
+			if (!free_slot_indexes_.empty()) {
+				const auto index = free_slot_indexes_.back();
+				return key_codec_.encode({index, slots_[index].generation});
+			}
+
+			if (slots_.size() >= key_codec_.max_slot_count()) { throw std::length_error("No slot is left in slot_map."); }
+			return key_codec_.encode({static_cast<uint32_t>(slots_.size()), 0});
+		}
+
+		[[nodiscard]] iterator find(const Key& key) {
+			const auto index = find_slot_index(key);
+			return index.has_value() ? iterator(slots_.begin() + *index, slots_.end()) : end();
+		}
+
+		[[nodiscard]] const_iterator find(const Key& key) const {
+			const auto index = find_slot_index(key);
+			return index.has_value() ? const_iterator(slots_.begin() + *index, slots_.end()) : end();
+		}
+
+		[[nodiscard]] bool contains(const Key& key) const { return find_slot_index(key).has_value(); }
+
+		/**
+		 * Get a value with key.
+		 *
+		 * @param key A key of the value.
+		 * @return A value.
+		 * @throw std::out_of_range The value with key does not exist.
+		 */
+		[[nodiscard]] Value& at(const Key& key) {
+			const auto index = find_slot_index(key);
+			if (!index.has_value()) { throw std::out_of_range("The key does not exist in slot_map."); }
+			return slots_[*index].entry->second;
+		}
+
+		/**
+		 * Get a value with key.
+		 *
+		 * @param key A key of the value.
+		 * @return A value.
+		 * @throw std::out_of_range The value with key does not exist.
+		 */
+		[[nodiscard]] const Value& at(const Key& key) const {
+			const auto index = find_slot_index(key);
+			if (!index.has_value()) { throw std::out_of_range("The key does not exist in slot_map."); }
+			return slots_[*index].entry->second;
+		}
+
+		/**
+		 * Add a value if key is next_key(). Nothing is done if a value with key already exists.
+		 *
+		 * @param key A key of the value.
+		 * @param value A value to add.
+		 * @return An iterator of the value with key and whether the value is added.
+		 * @throw std::invalid_argument A value with key does not exist and key is not next_key().
+		 */
+		template <typename V>
+		std::pair<iterator, bool> emplace(const Key& key, V&& value) {
+			if (const auto it = find(key); it != end()) { return {it, false}; }
+			if (key != next_key()) { throw std::invalid_argument("The key is not issued by slot_map."); }
+
+			uint32_t index;
+			if (free_slot_indexes_.empty()) {
+				index = static_cast<uint32_t>(slots_.size());
+				slots_.emplace_back();
+				try { slots_.back().entry.emplace(key, std::forward<V>(value)); }
+				catch (...) {
+					slots_.pop_back();
+					throw;
+				}
+			}
+			else {
+				index = free_slot_indexes_.back();
+				slots_[index].entry.emplace(key, std::forward<V>(value));
+				free_slot_indexes_.pop_back();
+			}
+
+			++size_;
+			return {iterator(slots_.begin() + index, slots_.end()), true};
+		}
+
+		/**
+		 * Add a value if key is next_key(), or update the value with key.
+		 *
+		 * @param key A key of the value.
+		 * @param value A value to add or update.
+		 * @return An iterator of the value with key and whether the value is added.
+		 * @throw std::invalid_argument A value with key does not exist and key is not next_key().
+		 */
+		template <typename V>
+		std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value) {
+			if (const auto it = find(key); it != end()) {
+				it->second = std::forward<V>(value);
+				return {it, false};
+			}
+
+			return emplace(key, std::forward<V>(value));
+		}
+
+		iterator erase(const const_iterator it) {
+			const auto index = static_cast<size_t>(it.it_ - slots_.cbegin());
+			auto& slot = slots_[index];
+			slot.entry.reset();
+			++slot.generation;
+			free_slot_indexes_.push_back(static_cast<uint32_t>(index));
+			--size_;
+			return iterator(slots_.begin() + static_cast<std::ptrdiff_t>(index) + 1, slots_.end());
+		}
+
+		size_t erase(const Key& key) {
+			const auto it = find(key);
+			if (it == end()) { return 0; }
+
+			erase(const_iterator(it));
+			return 1;
+		}
+
+		[[nodiscard]] size_t size() const { return size_; }
+
+		[[nodiscard]] bool empty() const { return size_ == 0; }
+
+		[[nodiscard]] iterator begin() { return iterator(slots_.begin(), slots_.end()); }
+
+		[[nodiscard]] iterator end() { return iterator(slots_.end(), slots_.end()); }
+
+		[[nodiscard]] const_iterator begin() const { return const_iterator(slots_.begin(), slots_.end()); }
+
+		[[nodiscard]] const_iterator end() const { return const_iterator(slots_.end(), slots_.end()); }
+
+	private:
+		KeyCodec key_codec_;
+		slot_container_type slots_;
+		// Released slots are reused from the last one.
+		std::vector<uint32_t> free_slot_indexes_;
+		size_t size_ = 0;
+
+		[[nodiscard]] std::optional<size_t> find_slot_index(const Key& key) const {
+			const auto index = key_codec_.decode(key).index;
+			if (index >= slots_.size()) { return std::nullopt; }
+
+			// The generation is checked by comparing keys because KeyCodec may drop upper bits of the generation.
+			const auto& entry = slots_[index].entry;
+			if (!entry.has_value() || entry->first != key) { return std::nullopt; }
+			return index;
+		}
+	};
+}
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <unordered_map>
-#include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <functional>
@@ -9,6 +8,7 @@
 #include <utility>
 #include <vector>
 #include <algorithm>
+#include <tuple>
 
 #include <boost/noncopyable.hpp>
 #include <boost/call_traits.hpp>
@@ -29,25 +29,30 @@ namespace pgl {
 	 */
 	template <typename Data, auto Data::* IdMemberVariable, auto Data::*... UniqueMemberVariables>
 	class unique_variables_container final {
-		template <auto Data::* P>
-		using multi_index_hashed_unique_member_t = boost::multi_index::hashed_unique<
-			boost::multi_index::member<
-				Data,
-				member_variable_pointer_variable_t<P>,
-				P
-			>
-		>;
+		using id_type = member_variable_pointer_variable_t<IdMemberVariable>;
+		using id_param_type = typename boost::call_traits<id_type>::param_type;
+
+		// Only the ID and the values of unique member variables are kept, so data are not copied into this container.
+		using key_type = std::tuple<id_type, member_variable_pointer_variable_t<UniqueMemberVariables>...>;
 
-		// it is efficient to use std::reference_wrapper<const Data> but using it causes unintentionally behavior which prevents pass tests so use Data
-		using container_type = boost::multi_index_container<
-			Data,
+		template <size_t Index>
+		struct key_element_extractor final {
+			using result_type = std::tuple_element_t<Index, key_type>;
+
+			const result_type& operator()(const key_type& key) const { return std::get<Index>(key); }
+		};
+
+		template <size_t... Indexes>
+		static auto make_container_type(std::index_sequence<Indexes...>) -> boost::multi_index_container<
+			key_type,
 			boost::multi_index::indexed_by<
-				multi_index_hashed_unique_member_t<IdMemberVariable>,
-				multi_index_hashed_unique_member_t<UniqueMemberVariables>...
+				boost::multi_index::hashed_unique<key_element_extractor<Indexes>>...
 			>
 		>;
-		using id_type = member_variable_pointer_variable_t<IdMemberVariable>;
-		using id_param_type = typename boost::call_traits<id_type>::param_type;
+
+		constexpr static size_t unique_variable_count = 1 + sizeof...(UniqueMemberVariables);
+
+		using container_type = decltype(make_container_type(std::make_index_sequence<unique_variable_count>()));
 
 	public:
 		/**
@@ -56,14 +61,18 @@ namespace pgl {
 		 * @param data A data to add or update.
 		 */
 		void add_or_update_variables(const Data& data) {
-			auto& id_index = data_.template get<0>();
-			const auto it = id_index.find(data.*IdMemberVariable);
-			if (it == id_index.end()) {
-				data_.emplace(data);
-				return;
-			}
+			// IDs are already unique as keys of the owner container, so nothing has to be kept if there are no other unique member variables.
+			if constexpr (unique_variable_count == 1) { return; }
+			else {
+				auto& id_index = data_.template get<0>();
+				const auto it = id_index.find(data.*IdMemberVariable);
+				if (it == id_index.end()) {
+					data_.emplace(make_key(data));
+					return;
+				}
 
-			id_index.replace(it, data);
+				id_index.replace(it, make_key(data));
+			}
 		}
 
 		/**
@@ -71,7 +80,9 @@ namespace pgl {
 		 *
 		 * @param id An ID of data to remove.
 		 */
-		void remove_variables(id_param_type id) { data_.erase(id); }
+		void remove_variables(id_param_type id) {
+			if constexpr (unique_variable_count > 1) { data_.erase(id); }
+		}
 
 		/**
 		 * Check if indicated data is unique for id and all unique member variables.
@@ -84,7 +95,10 @@ namespace pgl {
 
 	private:
 		container_type data_;
-		constexpr static size_t unique_variable_count = 1 + sizeof...(UniqueMemberVariables);
+
+		static key_type make_key(const Data& data) {
+			return key_type(data.*IdMemberVariable, data.*UniqueMemberVariables...);
+		}
 
 		template <size_t Index = 0> requires(Index < unique_variable_count)
 		[[nodiscard]] bool is_unique_in_all_indexes(const Data& data) const {
@@ -94,7 +108,7 @@ namespace pgl {
 			const auto it = c.find(v);
 			auto is_unique = it == c.end();
 			// Ignore duplication with myself 
-			if (!is_unique && *it.*IdMemberVariable == data.*IdMemberVariable) { is_unique = true; }
+			if (!is_unique && std::get<0>(*it) == data.*IdMemberVariable) { is_unique = true; }
 			return is_unique_in_all_indexes<Index + 1>(data) && is_unique;
 		}
 
@@ -111,15 +125,23 @@ namespace pgl {
 		using runtime_error::runtime_error;
 	};
 
+	// A storage which issues the ID of the next data by itself like slot_map.
+	template <class T>
+	concept id_issuing_storage = requires(const T& storage)
+	{
+		storage.next_key();
+	};
+
 	/**
 	 * A container to hold data and manage them with id thread safely.
 	 * 
+	 * @tparam Storage A type of map from ID to data which has same interface as std::unordered_map.
 	 * @tparam Data A type of data to hold.
 	 * @tparam IdMemberVariable A member variable pointer of ID value.
 	 * @tparam UniqueMemberVariables Member variable pointers of the member variables in Data which should be unique in this container.
 	 */
-	template <typename Data, auto Data::* IdMemberVariable, auto Data::*... UniqueMemberVariables>
-	class thread_safe_data_container final : boost::noncopyable {
+	template <typename Storage, typename Data, auto Data::* IdMemberVariable, auto Data::*... UniqueMemberVariables>
+	class basic_thread_safe_data_container final : boost::noncopyable {
 	public:
 		using id_type = member_variable_pointer_variable_t<IdMemberVariable>;
 		using id_param_type = typename boost::call_traits<id_type>::param_type;
@@ -130,6 +152,10 @@ namespace pgl {
 			size_t total_count;
 		};
 
+		basic_thread_safe_data_container() = default;
+
+		explicit basic_thread_safe_data_container(Storage&& storage) : data_map_(std::move(storage)) {}
+
 		/**
 		 * Add or update data.
 		 *
@@ -143,8 +169,8 @@ namespace pgl {
 
 			if (!unique_variables_.is_unique(data)) { throw unique_variable_duplication_error(); }
 
-			auto&& [it, is_added] = data_map_.insert_or_assign(id, data);
-			unique_variables_.add_or_update_variables(it->second.load());
+			auto&& [it, is_added] = data_map_.insert_or_assign(id, std::move(data));
+			unique_variables_.add_or_update_variables(it->second);
 			return is_added;
 		}
 
@@ -161,21 +187,21 @@ namespace pgl {
 		 * Add new data with automatically assigned ID.
 		 *
 		 * @param data Data of rvalue reference
-		 * @param random_id_generator (optional) A functions to generate new ID. In default, built-in random value generator will be used.
+		 * @param random_id_generator (optional) A functions to generate new ID. In default, built-in random value generator will be used. This is not used if Storage issues IDs.
 		 * @return An ID assigned to new data.
 		 * @throw unique_variable_duplication_error Unique member variable is duplicated.
 		 */
 		id_type assign_id_and_add(Data&& data,
 			std::function<id_type()>&& random_id_generator = generate_random_id<id_type>) {
 			std::lock_guard lock(mutex_);
-			return assign_id_and_add_impl(data, random_id_generator);
+			return assign_id_and_add_impl(std::move(data), random_id_generator);
 		}
 
 		/**
 		 * Add new data with automatically assigned ID.
 		 *
 		 * @param data Data to add.
-		 * @param random_id_generator (optional) A functions to generate new ID. In default, built-in random value generator will be used.
+		 * @param random_id_generator (optional) A functions to generate new ID. In default, built-in random value generator will be used. This is not used if Storage issues IDs.
 		 * @return An ID assigned to new data.
 		 * @throw unique_variable_duplication_error Unique member variable is duplicated.
 		 */
@@ -189,7 +215,7 @@ namespace pgl {
 		 *
 		 * @param data Data of rvalue reference
 		 * @param max_size Maximum number of data allowed in this container.
-		 * @param random_id_generator (optional) A functions to generate new ID. In default, built-in random value generator will be used.
+		 * @param random_id_generator (optional) A functions to generate new ID. In default, built-in random value generator will be used. This is not used if Storage issues IDs.
 		 * @return An ID assigned to new data. std::nullopt if the container already reached max_size.
 		 * @throw unique_variable_duplication_error Unique member variable is duplicated.
 		 */
@@ -197,7 +223,7 @@ namespace pgl {
 			std::function<id_type()>&& random_id_generator = generate_random_id<id_type>) {
 			std::lock_guard lock(mutex_);
 			if (data_map_.size() >= max_size) { return std::nullopt; }
-			return assign_id_and_add_impl(data, random_id_generator);
+			return assign_id_and_add_impl(std::move(data), random_id_generator);
 		}
 
 		/**
@@ -205,7 +231,7 @@ namespace pgl {
 		 *
 		 * @param data Data to add.
 		 * @param max_size Maximum number of data allowed in this container.
-		 * @param random_id_generator (optional) A functions to generate new ID. In default, built-in random value generator will be used.
+		 * @param random_id_generator (optional) A functions to generate new ID. In default, built-in random value generator will be used. This is not used if Storage issues IDs.
 		 * @return An ID assigned to new data. std::nullopt if the container already reached max_size.
 		 * @throw unique_variable_duplication_error Unique member variable is duplicated.
 		 */
@@ -223,7 +249,7 @@ namespace pgl {
 		 */
 		[[nodiscard]] Data get(id_param_type id) const {
 			std::shared_lock lock(mutex_);
-			return data_map_.at(id).load();
+			return data_map_.at(id);
 		}
 
 		/**
@@ -236,7 +262,7 @@ namespace pgl {
 			std::shared_lock lock(mutex_);
 			const auto it = data_map_.find(id);
 			if (it == data_map_.end()) { return std::nullopt; }
-			return it->second.load();
+			return it->second;
 		}
 
 		/**
@@ -253,13 +279,13 @@ namespace pgl {
 			const auto it = data_map_.find(id);
 			if (it == data_map_.end()) { return std::nullopt; }
 
-			auto data = it->second.load();
+			auto data = it->second;
 			update_function(data);
 			data.*IdMemberVariable = id;
 			if (!unique_variables_.is_unique(data)) { throw unique_variable_duplication_error(); }
 
-			it->second.store(data);
 			unique_variables_.add_or_update_variables(data);
+			it->second = data;
 			return data;
 		}
 
@@ -276,7 +302,7 @@ namespace pgl {
 			const auto it = data_map_.find(id);
 			if (it == data_map_.end()) { return std::nullopt; }
 
-			const auto data = it->second.load();
+			const auto data = it->second;
 			if (!remove_function(data)) { return std::nullopt; }
 
 			unique_variables_.remove_variables(id);
@@ -286,15 +312,17 @@ namespace pgl {
 
 		/**
 		 * Search data by filter and return sorted result.
+		 * Functions are template parameters so that they can be inlined in loops over data instead of being called through std::function.
 		 *
 		 * @param compare_function A function used to sort.
 		 * @param filter_function A function used to filter.
 		 * @return A list of data.
 		 */
-		[[nodiscard]] std::vector<Data> search(
-			std::function<bool(data_param_type, data_param_type)>&& compare_function,
-			std::function<bool(data_param_type)>&& filter_function) const {
-			auto result = search_with_total(std::move(compare_function), std::move(filter_function));
+		template <typename CompareFunction, typename FilterFunction>
+		[[nodiscard]] std::vector<Data> search(CompareFunction&& compare_function,
+			FilterFunction&& filter_function) const {
+			auto result = search_with_total(std::forward<CompareFunction>(compare_function),
+				std::forward<FilterFunction>(filter_function));
 			return std::move(result.data);
 		}
 
@@ -305,16 +333,16 @@ namespace pgl {
 		 * @param filter_function A function used to filter.
 		 * @return A list of data and the total number of data at the time the list was collected.
 		 */
-		[[nodiscard]] search_result search_with_total(
-			std::function<bool(data_param_type, data_param_type)>&& compare_function,
-			std::function<bool(data_param_type)>&& filter_function) const {
+		template <typename CompareFunction, typename FilterFunction>
+		[[nodiscard]] search_result search_with_total(CompareFunction&& compare_function,
+			FilterFunction&& filter_function) const {
 			search_result result;
 			{
 				std::shared_lock lock(mutex_);
 				result.total_count = data_map_.size();
 				result.data.reserve(result.total_count);
 				for (auto&& pair : data_map_) {
-					if (const auto data_elem = pair.second.load(); filter_function(data_elem)) {
+					if (const auto& data_elem = pair.second; filter_function(data_elem)) {
 						result.data.push_back(data_elem);
 					}
 				}
@@ -332,10 +360,11 @@ namespace pgl {
 		 * @param filter_function A function used to filter.
 		 * @return A list of data.
 		 */
+		template <typename CompareFunction, typename FilterFunction>
 		[[nodiscard]] std::vector<Data> search_range(const size_t start_idx, size_t count,
-			std::function<bool(data_param_type, data_param_type)>&& compare_function,
-			std::function<bool(data_param_type)>&& filter_function) const {
-			std::vector<Data> data = search(std::move(compare_function), std::move(filter_function));
+			CompareFunction&& compare_function, FilterFunction&& filter_function) const {
+			std::vector<Data> data = search(std::forward<CompareFunction>(compare_function),
+				std::forward<FilterFunction>(filter_function));
 			count = std::min(count, data.size() >= start_idx ? data.size() - start_idx : 0);
 			std::vector<Data> result(count);
 			const auto end_idx_plus_one = start_idx + count;
@@ -366,36 +395,55 @@ namespace pgl {
 			return data_map_.erase(id) == 1;
 		}
 
+		/**
+		 * Get the ID which the storage issues for the next data. Data added with other IDs are rejected by such a storage.
+		 *
+		 * @return An ID of the next data.
+		 */
+		[[nodiscard]] id_type next_id() const requires id_issuing_storage<Storage> {
+			std::shared_lock lock(mutex_);
+			return data_map_.next_key();
+		}
+
 		/**
 		 * Get the number of data.
 		 *
 		 * @return The number of data.
 		 */
 		[[nodiscard]] size_t size() const {
-			// Reading unordered_map::size can race with writers, so protect it like other read operations.
+			// Reading the size of the storage can race with writers, so protect it like other read operations.
 			std::shared_lock lock(mutex_);
 			return data_map_.size();
 		}
 
 	private:
-		std::unordered_map<id_type, std::atomic<Data>> data_map_;
+		// Every access to data is guarded by mutex_, so data are stored as is instead of std::atomic, which falls back to a lock per access for large data.
+		Storage data_map_;
 		unique_variables_container<Data, IdMemberVariable, UniqueMemberVariables...> unique_variables_;
 		mutable std::shared_mutex mutex_;
 
 		static id_type get_id(const data_param_type data) { return data.*IdMemberVariable; }
 
-		id_type assign_id_and_add_impl(Data& data, const std::function<id_type()>& random_id_generator) {
+		id_type assign_id_and_add_impl(Data&& data, const std::function<id_type()>& random_id_generator) {
 			id_type id{};
-			do { id = random_id_generator(); }
-			while (data_map_.contains(id));
+			if constexpr (id_issuing_storage<Storage>) { id = data_map_.next_key(); }
+			else {
+				do { id = random_id_generator(); }
+				while (data_map_.contains(id));
+			}
 			data.*IdMemberVariable = id;
 
 			// Check if unique because ensure id of passed data is not duplicate existing id
 			if (!unique_variables_.is_unique(data)) { throw unique_variable_duplication_error(); }
 
-			auto&& [it,_] = data_map_.emplace(id, data);
+			auto&& [it,_] = data_map_.emplace(id, std::move(data));
 			unique_variables_.add_or_update_variables(it->second);
 			return id;
 		}
 	};
+
+	template <typename Data, auto Data::* IdMemberVariable, auto Data::*... UniqueMemberVariables>
+	using thread_safe_data_container = basic_thread_safe_data_container<
+		std::unordered_map<member_variable_pointer_variable_t<IdMemberVariable>, Data>, Data, IdMemberVariable,
+		UniqueMemberVariables...>;
 }
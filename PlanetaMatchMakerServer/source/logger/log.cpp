@@ -1,5 +1,6 @@
 #include <unordered_map>
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 
 #include "log.hpp"
@@ -13,13 +14,22 @@ namespace pgl {
 	static mutex output_mutex;
 	std::vector<std::unique_ptr<logger>> loggers;
 	bool are_all_loggers_thread_safe = true;
+	// The lowest level threshold of added loggers. No level is enabled until a logger is added.
+	static atomic<int> lowest_level_threshold = static_cast<int>(log_level::fatal) + 1;
 
 	void add_logger(std::unique_ptr<logger>&& logger) {
 		lock_guard lock(logger_registry_mutex);
 		are_all_loggers_thread_safe &= logger->is_thread_safe();
+		const auto level_threshold = static_cast<int>(logger->level_threshold());
+		if (level_threshold < lowest_level_threshold.load()) { lowest_level_threshold.store(level_threshold); }
 		loggers.push_back(std::move(logger));
 	}
 
+	bool is_log_level_enabled(const log_level level) {
+		// Relaxed order is enough because loggers are added at startup before any session logs.
+		return static_cast<int>(level) >= lowest_level_threshold.load(memory_order_relaxed);
+	}
+
 	void log_impl(const log_level level, string&& header, string&& message) {
 		std::vector<logger*> active_loggers;
 		bool all_loggers_thread_safe;
@@ -17,9 +17,13 @@ namespace pgl {
 	// Implementation of thread safe log function.
 	void log_impl(log_level level, std::string&& header, std::string&& message);
 
+	// Check if any added logger outputs logs of the level. Log functions return before building strings if not.
+	[[nodiscard]] bool is_log_level_enabled(log_level level);
+
 	// Log thread safely.
 	template <typename ... Params>
 	void log(const log_level level, Params&& ... params) {
+		if (!is_log_level_enabled(level)) { return; }
 		log_impl(level, "", minimal_serializer::generate_string(params...));
 	}
 
@@ -28,6 +32,7 @@ namespace pgl {
 	void log_with_endpoint(const log_level level,
 		const boost::asio::basic_socket<boost::asio::ip::tcp>::endpoint_type& endpoint,
 		Params&& ... params) {
+		if (!is_log_level_enabled(level)) { return; }
 		log_impl(level, minimal_serializer::generate_string(" @", endpoint),
 			minimal_serializer::generate_string(params...));
 	}
@@ -37,6 +42,7 @@ namespace pgl {
 	void log_with_session_and_endpoint(const log_level level, const session_number_t session_number,
 		const boost::asio::basic_socket<boost::asio::ip::tcp>::endpoint_type& endpoint,
 		Params&& ... params) {
+		if (!is_log_level_enabled(level)) { return; }
 		log_impl(level, minimal_serializer::generate_string(" [session:", session_number, "] @", endpoint),
 			minimal_serializer::generate_string(params...));
 	}
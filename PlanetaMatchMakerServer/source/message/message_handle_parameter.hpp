@@ -1,6 +1,6 @@
 #pragma once
 
-#include <boost/asio/spawn.hpp>
+#include <chrono>
 
 namespace pgl {
 	class client_connection;
@@ -11,7 +11,6 @@ namespace pgl {
 	struct message_handle_parameter final {
 		client_connection& connection;
 		server_data& server_data;
-		boost::asio::yield_context yield;
 		std::chrono::seconds timeout_seconds;
 		session_data& session_data;
 		const server_setting& server_setting;
@@ -1,6 +1,42 @@
 #include "message_handle_utilities.hpp"
 
 namespace pgl {
+	boost::asio::awaitable<void> send_queued(const std::shared_ptr<message_handle_parameter> param) {
+		const auto queued_size = param->connection.queued_write_size();
+		if (queued_size == 0) { co_return; }
+
+		try {
+			co_await execute_socket_timed_async_operation(param->connection, param->timeout_seconds,
+				param->connection.async_write_queued());
+			log_with_session(log_level::debug, param, "Send queued data (", queued_size,
+				" bytes) to the client.");
+		}
+		catch (const boost::system::system_error& e) {
+			auto extra_message = minimal_serializer::generate_string("Failed to send queued data (", queued_size,
+				" bytes) to the client. ",
+				e.code().message());
+			if (e.code() == boost::asio::error::operation_aborted) {
+				throw server_session_error(extra_message + "(Failed to send message due to timeout)");
+			}
+			if (e.code() == boost::asio::error::eof) {
+				throw server_session_error(extra_message + "(Disconnected unexpectedly)");
+			}
+			throw server_session_error(extra_message);
+		}
+	}
+
+	boost::asio::awaitable<void> send_queued_unless_request_pipelined(std::shared_ptr<message_handle_parameter> param) {
+		if (param->connection.received_data_size() == 0) { co_await send_queued(param); }
+	}
+
+	boost::asio::awaitable<void> send_packed(std::shared_ptr<message_handle_parameter> param,
+		const std::shared_ptr<const std::vector<uint8_t>> packed_data) {
+		param->connection.queue_write(*packed_data);
+		log_with_session(log_level::debug, param, "Queue packed data (", packed_data->size(),
+			" bytes) to send to the client.");
+		co_await send_queued_unless_request_pipelined(param);
+	}
+
 	bool does_room_exist(const std::shared_ptr<message_handle_parameter> param,
 		const room_data_container& room_data_container, room_id_t room_id) {
 		// Check room existence
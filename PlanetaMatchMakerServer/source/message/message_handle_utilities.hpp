@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <utility>
 
 #include "async/timer.hpp"
@@ -15,6 +16,7 @@
 namespace pgl {
 	template <typename ... Params>
 	void log_with_session(const log_level level, const message_handle_parameter& param, Params&& ... params) {
+		if (!is_log_level_enabled(level)) { return; }
 		if (const auto session_number = param.session_data.session_number(); session_number.has_value()) {
 			log_with_session_and_endpoint(level, *session_number, param.session_data.remote_endpoint().to_boost_endpoint(),
 				std::forward<Params>(params)...);
@@ -31,54 +33,61 @@ namespace pgl {
 		log_with_session(level, *param, std::forward<Params>(params)...);
 	}
 
-	// Send data to remote endpoint. server_session_error will be thrown when send error occurred.
+	/**
+	 * Send queued data to remote endpoint in one write.
+	 *
+	 * @param param A parameters for message handling.
+	 * @throw server_session_error Failed to send.
+	 */
+	boost::asio::awaitable<void> send_queued(std::shared_ptr<message_handle_parameter> param);
+
+	// Send queued data if no following request is received yet. Otherwise, keep it queued to send replies of pipelined requests together.
+	boost::asio::awaitable<void> send_queued_unless_request_pipelined(std::shared_ptr<message_handle_parameter> param);
+
+	// Queue data to send to remote endpoint without writing it. Use this to send parts of a reply in one write.
 	template <serializable FirstData, serializable... RestData>
-	void send(std::shared_ptr<message_handle_parameter> param, FirstData&& first_data, RestData&&... rest_data) {
-		auto data_summary = minimal_serializer::generate_string(sizeof...(rest_data) + 1, " data (",
-			get_packed_size<FirstData, RestData...>(), " bytes)");
+	void queue_send(const std::shared_ptr<message_handle_parameter>& param, FirstData&& first_data,
+		RestData&&... rest_data) {
+		packed_queue_write(param->connection, first_data, rest_data...);
+		log_with_session(log_level::debug, param, "Queue ", sizeof...(rest_data) + 1, " data (",
+			get_packed_size<FirstData, RestData...>(), " bytes) to send to the client.");
+	}
 
-		try {
-			execute_socket_timed_async_operation(param->connection, param->timeout_seconds,
-				[param, first_data, rest_data...]() {
-					packed_async_write(
-						param->connection, param->yield, first_data, rest_data...);
-				});
-			log_with_session(log_level::debug, param, "Send ", data_summary,
-				" to the client.");
-		}
-		catch (const boost::system::system_error& e) {
-			auto extra_message = minimal_serializer::generate_string("Failed to send ", data_summary,
-				" to the client. ",
-				e.code().message());
-			if (e.code() == boost::asio::error::operation_aborted) {
-				throw server_session_error(extra_message + "(Failed to send message due to timeout)");
-			}
-			if (e.code() == boost::asio::error::eof) {
-				throw server_session_error(extra_message + "(Disconnected unexpectedly)");
-			}
-			throw server_session_error(extra_message);
-		}
+	// Send data to remote endpoint. server_session_error will be thrown when send error occurred.
+	// The data may be queued and sent together with replies of following requests which are already received.
+	template <serializable FirstData, serializable... RestData>
+	boost::asio::awaitable<void> send(std::shared_ptr<message_handle_parameter> param, FirstData&& first_data,
+		RestData&&... rest_data) {
+		queue_send(param, std::forward<FirstData>(first_data), std::forward<RestData>(rest_data)...);
+		co_await send_queued_unless_request_pipelined(param);
 	}
 
+	// Send data which is already packed to remote endpoint. server_session_error will be thrown when send error occurred.
+	// The data may be queued and sent together with replies of following requests which are already received.
+	boost::asio::awaitable<void> send_packed(std::shared_ptr<message_handle_parameter> param,
+		std::shared_ptr<const std::vector<uint8_t>> packed_data);
+
 	// Receive data. server_session_error will be thrown when reception error occurred.
 	// todo: use shared_ptr to avoid invalid reference access in lambda function
 	template <typename FirstData, typename... RestData> requires(serializable_all<FirstData, RestData...> &&
 		not_constant_all<FirstData, RestData...>)
-	void receive(std::shared_ptr<message_handle_parameter> param, FirstData& first_data, RestData&... rest_data) {
-		auto data_summary = minimal_serializer::generate_string(sizeof...(rest_data) + 1, " data (",
-			get_packed_size<FirstData, RestData...>(), " bytes)");
+	boost::asio::awaitable<void> receive(std::shared_ptr<message_handle_parameter> param, FirstData& first_data,
+		RestData&... rest_data) {
+		constexpr auto data_size = get_packed_size<FirstData, RestData...>();
+		constexpr auto data_count = sizeof...(rest_data) + 1;
+
+		// Send queued replies before waiting for data which is not received yet.
+		if (param->connection.received_data_size() < data_size) { co_await send_queued(param); }
 
 		try {
-			execute_socket_timed_async_operation(param->connection, param->timeout_seconds,
-				[param, &first_data, &rest_data...]()mutable {
-					unpacked_async_read(param->connection, param->yield, first_data, rest_data...);
-				});
-			log_with_session(log_level::debug, param, "Receive ", data_summary,
-				" from the client.");
+			co_await execute_socket_timed_async_operation(param->connection, param->timeout_seconds,
+				unpacked_async_read(param->connection, first_data, rest_data...));
+			log_with_session(log_level::debug, param, "Receive ", data_count, " data (", data_size,
+				" bytes) from the client.");
 		}
 		catch (const boost::system::system_error& e) {
-			auto extra_message = minimal_serializer::generate_string("Failed to receive ", data_summary,
-				" from the client. ",
+			auto extra_message = minimal_serializer::generate_string("Failed to receive ", data_count, " data (",
+				data_size, " bytes) from the client. ",
 				e.code().message());
 			if (e.code() == boost::asio::error::operation_aborted) {
 				throw server_session_error(extra_message + "(Failed to receive message due to timeout)");
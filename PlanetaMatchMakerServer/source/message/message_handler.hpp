@@ -2,9 +2,11 @@
 
 #include <exception>
 #include <functional>
+#include <memory>
 #include <utility>
+#include <vector>
 
-#include <boost/asio/spawn.hpp>
+#include <boost/asio.hpp>
 
 #include "minimal_serializer/serializer.hpp"
 #include "client/client_errors.hpp"
@@ -12,6 +14,7 @@
 #include "message_handle_parameter.hpp"
 
 namespace pgl {
+	// Handlers are stateless and const, so one instance is shared by all sessions and threads.
 	class message_handler {
 	public:
 		message_handler() = default;
@@ -20,8 +23,8 @@ namespace pgl {
 		virtual ~message_handler() = default;
 		message_handler& operator=(const message_handler& message_handler) = delete;
 		message_handler& operator=(message_handler&& message_handler) = delete;
-		virtual void operator()(const request_message_header& header,
-			std::shared_ptr<message_handle_parameter> param) = 0;
+		virtual boost::asio::awaitable<void> operator()(const request_message_header& header,
+			std::shared_ptr<message_handle_parameter> param) const = 0;
 		[[nodiscard]] virtual size_t get_message_size() const = 0;
 	};
 
@@ -30,12 +33,17 @@ namespace pgl {
 		std::vector<ReplyMessage> reply_bodies;
 		bool is_disconnect_required;
 		std::function<void()> on_reply_failure = {};
+		// Reply headers and bodies which are already packed. This is sent as is instead of reply_bodies if it is set.
+		std::shared_ptr<const std::vector<uint8_t>> packed_reply = {};
 	};
 
 	class no_reply final { };
 
 	template <class RequestMessage, class ReplyMessage = no_reply>
 	class message_handler_base : public message_handler {
+		static_assert(minimal_serializer::serialized_size_v<RequestMessage> <=
+			client_connection::default_receive_buffer_capacity, "The request message does not fit in the receive buffer.");
+
 	public:
 		using handle_return_t = message_handling_result<ReplyMessage>;
 
@@ -50,29 +58,33 @@ namespace pgl {
 			return minimal_serializer::serialized_size_v<RequestMessage>;
 		}
 
-		void operator()(const request_message_header& header, std::shared_ptr<message_handle_parameter> param) final {
+		boost::asio::awaitable<void> operator()(const request_message_header& header,
+			std::shared_ptr<message_handle_parameter> param) const final {
 			// receive message
 			log_with_session(log_level::info, param, "Receive ", header.message_type,
 				" message.");
 			RequestMessage message{};
-			receive(param, message);
+			co_await receive(param, message);
 
 			bool is_disconnect_required;
-			std::string disconnect_reason;
+			// A literal, so no string is built unless the session is disconnected.
+			const char* disconnect_reason;
 			reply_message_header reply_header{
 				header.message_type,
 				message_error_code::ok,
 			};
 			std::vector<ReplyMessage> reply_bodies;
 			std::function<void()> on_reply_failure;
+			std::shared_ptr<const std::vector<uint8_t>> packed_reply;
 			try {
 				// handle message
 				log_with_session(log_level::info, param, "Handle ",
 					header.message_type, " message.");
-				auto result = handle_message(message, param);
+				auto result = co_await handle_message(message, param);
 				is_disconnect_required = result.is_disconnect_required;
 				reply_bodies = std::move(result.reply_bodies);
 				on_reply_failure = std::move(result.on_reply_failure);
+				packed_reply = std::move(result.packed_reply);
 				reply_header.error_code = message_error_code::ok;
 				disconnect_reason = "Disconnect due to message handling result.";
 			}
@@ -100,20 +112,30 @@ namespace pgl {
 			// reply message if required
 			if constexpr (!std::is_same_v<ReplyMessage, no_reply>) {
 				try {
-					if (reply_bodies.empty()) {
+					if (packed_reply) {
+						log_with_session(log_level::info, param, "Reply ",
+							header.message_type, " message from packed data (", packed_reply->size(), " bytes).");
+						co_await send_packed(param, std::move(packed_reply));
+					}
+					else if (reply_bodies.empty()) {
 						log_with_session(log_level::info, param, "Reply ",
 							header.message_type, " message without body (", get_packed_size<reply_message_header>(),
 							" bytes).");
-						send(param, reply_header);
+						co_await send(param, reply_header);
 					}
 					else {
+						// Gather all parts of the reply so that they are sent in one write under one deadline.
 						for (auto&& reply_body : reply_bodies) {
 							log_with_session(log_level::info, param, "Reply ",
 								header.message_type, " message (", get_packed_size<reply_message_header, ReplyMessage>(),
 								" bytes).");
-							send(param, reply_header, reply_body);
+							queue_send(param, reply_header, reply_body);
 						}
+						co_await send_queued_unless_request_pipelined(param);
 					}
+
+					// Send the reply now so that a failure is handled by on_reply_failure even if following requests are pipelined.
+					if (on_reply_failure) { co_await send_queued(param); }
 				}
 				catch (...) {
 					if (on_reply_failure) {
@@ -141,7 +163,7 @@ namespace pgl {
 		 * @param param A parameters for message handling.
 		 * @return A tuple of reply message and whether disconnect is required.
 		 */
-		virtual handle_return_t handle_message(const RequestMessage& message,
-			std::shared_ptr<message_handle_parameter> param) = 0;
+		virtual boost::asio::awaitable<handle_return_t> handle_message(const RequestMessage& message,
+			std::shared_ptr<message_handle_parameter> param) const = 0;
 	};
 }
@@ -1,5 +1,7 @@
 #include "message_handler_invoker.hpp"
 
+#include <exception>
+
 #include <boost/asio.hpp>
 
 #include "logger/log.hpp"
@@ -11,23 +13,41 @@ using namespace boost;
 using namespace minimal_serializer;
 
 namespace pgl {
-	void message_handler_invoker::
+	asio::awaitable<void> message_handler_invoker::
 	handle_message(std::shared_ptr<message_handle_parameter> param) const {
-		handle_message_impl(false, {}, std::move(param));
+		co_await handle_message_impl(false, {}, std::move(param));
 	}
 
-	void message_handler_invoker::handle_specific_message(const message_type specified_message_type,
+	asio::awaitable<void> message_handler_invoker::handle_specific_message(const message_type specified_message_type,
 		std::shared_ptr<message_handle_parameter> param) const {
-		handle_message_impl(true, specified_message_type, std::move(param));
+		co_await handle_message_impl(true, specified_message_type, std::move(param));
+	}
+
+	asio::awaitable<void> message_handler_invoker::handle_message_impl(const bool enable_message_specification,
+		const message_type specified_message_type, const std::shared_ptr<message_handle_parameter> param) const {
+		std::exception_ptr handling_exception;
+		try { co_await receive_and_handle_message(enable_message_specification, specified_message_type, param); }
+		catch (...) { handling_exception = std::current_exception(); }
+
+		if (handling_exception) {
+			// Deliver queued replies of preceding pipelined requests before the error closes the connection.
+			// A failure of this delivery is ignored because the original error is more relevant.
+			try { co_await send_queued(param); }
+			catch (const server_session_error&) {}
+			std::rethrow_exception(handling_exception);
+		}
 	}
 
-	void message_handler_invoker::handle_message_impl(const bool enable_message_specification,
+	asio::awaitable<void> message_handler_invoker::receive_and_handle_message(const bool enable_message_specification,
 		message_type specified_message_type, const std::shared_ptr<message_handle_parameter> param) const {
+		const auto operation_count_before = param->connection.get_socket_operation_count();
+
 		// Receive ana analyze a message header
 		request_message_header header{};
-		receive(param, header);
+		co_await receive(param, header);
 
-		if (!is_handler_exist(header.message_type)) {
+		const auto* const message_handler = find_message_handler(header.message_type);
+		if (message_handler == nullptr) {
 			const auto error_message = generate_string("Invalid message type: ", static_cast<int>(header.message_type));
 			throw server_session_intended_disconnect_error(error_message);
 		}
@@ -38,16 +58,19 @@ namespace pgl {
 			throw server_session_intended_disconnect_error(error_message);
 		}
 
-		const auto message_handler = make_message_handler(header.message_type);
 		constexpr auto header_size = minimal_serializer::serialized_size_v<request_message_header>;
 		const auto message_size = message_handler->get_message_size();
 		log_with_session(log_level::info, param, "Message header received. (type: ",
 			header.message_type, ", size: ", header_size, ")");
 
 		// Receive and process a body of message
-		(*message_handler)(header, param);
+		co_await (*message_handler)(header, param);
 
+		// Reads and writes of replies of pipelined requests are counted in the request which sends them.
+		const auto& operation_count = param->connection.get_socket_operation_count();
 		log_with_session(log_level::info, param, "Message processed. (type: ",
-			header.message_type, ", size: ", message_size, ")");
+			header.message_type, ", size: ", message_size, ", socket reads: ",
+			operation_count.read_count - operation_count_before.read_count, ", socket writes: ",
+			operation_count.write_count - operation_count_before.write_count, ")");
 	}
 }
@@ -1,7 +1,6 @@
 #pragma once
 
-#include <unordered_map>
-#include <functional>
+#include <array>
 #include <cassert>
 
 #include "logger/log.hpp"
@@ -10,37 +9,58 @@
 #include "message_handle_parameter.hpp"
 
 namespace pgl {
+	// One instance of a handler which is shared by all invokers. Handlers are stateless, so sharing is safe.
+	template <class MessageHandler> requires(std::derived_from<MessageHandler, message_handler>)
+	inline const MessageHandler shared_message_handler{};
+
 	// Registration is not thread safe. Message handling is read-only after registration.
 	class message_handler_invoker final : boost::noncopyable {
 	public:
-		using message_handler_generator_type = std::function<std::unique_ptr<message_handler>()>;
+		// Handlers indexed by message type. nullptr for a message type without a handler.
+		using handler_table_type = std::array<const message_handler*, message_type_count>;
+
+		// Set the shared handler for a message type to a table. This is usable to build a table at compile time.
+		template <message_type MessageType, class MessageHandler> requires(std::derived_from<MessageHandler,
+			message_handler>)
+		static constexpr void set_handler(handler_table_type& handler_table) {
+			handler_table[static_cast<size_t>(MessageType)] = &shared_message_handler<MessageHandler>;
+		}
+
+		message_handler_invoker() = default;
+
+		explicit message_handler_invoker(const handler_table_type& handler_table) : handler_table_(handler_table) {}
 
 		template <message_type MessageType, class MessageHandler> requires(std::derived_from<MessageHandler,
 			message_handler>)
 		void register_handler() {
-			assert(!handler_generator_map_.contains(MessageType));
+			assert(!is_handler_exist(MessageType));
 			log(log_level::debug, "Register message handler (", NAMEOF_TYPE(MessageHandler), ") for ", MessageType,
 				".");
-			handler_generator_map_.emplace(MessageType, []() { return std::make_unique<MessageHandler>(); });
+			set_handler<MessageType, MessageHandler>(handler_table_);
 		}
 
-		void handle_message(std::shared_ptr<message_handle_parameter> param) const;
+		boost::asio::awaitable<void> handle_message(std::shared_ptr<message_handle_parameter> param) const;
 
-		void handle_specific_message(message_type specified_message_type,
+		boost::asio::awaitable<void> handle_specific_message(message_type specified_message_type,
 			std::shared_ptr<message_handle_parameter> param) const;
 
 	private:
-		std::unordered_map<message_type, message_handler_generator_type> handler_generator_map_;
+		handler_table_type handler_table_{};
 
-		[[nodiscard]] bool is_handler_exist(const message_type message_type) const {
-			return handler_generator_map_.contains(message_type);
+		// Message types come from clients, so an out of range value is checked here.
+		[[nodiscard]] const message_handler* find_message_handler(const message_type message_type) const {
+			const auto index = static_cast<size_t>(message_type);
+			return index < handler_table_.size() ? handler_table_[index] : nullptr;
 		}
 
-		[[nodiscard]] std::unique_ptr<message_handler> make_message_handler(const message_type message_type) const {
-			return handler_generator_map_.at(message_type)();
+		[[nodiscard]] bool is_handler_exist(const message_type message_type) const {
+			return find_message_handler(message_type) != nullptr;
 		}
 
-		void handle_message_impl(bool enable_message_specification, message_type specified_message_type,
-			std::shared_ptr<message_handle_parameter> param) const;
+		boost::asio::awaitable<void> handle_message_impl(bool enable_message_specification,
+			message_type specified_message_type, std::shared_ptr<message_handle_parameter> param) const;
+
+		boost::asio::awaitable<void> receive_and_handle_message(bool enable_message_specification,
+			message_type specified_message_type, std::shared_ptr<message_handle_parameter> param) const;
 	};
 }
@@ -9,27 +9,34 @@
 #include "message_handlers/keep_alive_notice_message_handler.hpp"
 
 namespace pgl {
-	void register_handlers(message_handler_invoker& invoker) {
-		invoker.register_handler<message_type::authentication, authentication_request_message_handler>();
-		invoker.register_handler<message_type::create_room, create_room_request_message_handler>();
-		invoker.register_handler<message_type::join_room, join_room_request_message_handler>();
-		invoker.register_handler<message_type::list_room, list_room_request_message_handler>();
-		invoker.register_handler<message_type::update_room_status, update_room_status_notice_message_handler
-		>();
-		invoker.register_handler<message_type::connection_test, connection_test_request_message_handler>();
-		invoker.register_handler<message_type::keep_alive, keep_alive_notice_message_handler>();
+	namespace {
+		constexpr message_handler_invoker::handler_table_type make_standard_handler_table() {
+			using invoker = message_handler_invoker;
+			invoker::handler_table_type handler_table{};
+			invoker::set_handler<message_type::authentication, authentication_request_message_handler>(handler_table);
+			invoker::set_handler<message_type::create_room, create_room_request_message_handler>(handler_table);
+			invoker::set_handler<message_type::join_room, join_room_request_message_handler>(handler_table);
+			invoker::set_handler<message_type::list_room, list_room_request_message_handler>(handler_table);
+			invoker::set_handler<message_type::update_room_status, update_room_status_notice_message_handler>(
+				handler_table);
+			invoker::set_handler<message_type::connection_test, connection_test_request_message_handler>(
+				handler_table);
+			invoker::set_handler<message_type::keep_alive, keep_alive_notice_message_handler>(handler_table);
+			return handler_table;
+		}
+
+		// Built at compile time, so dispatching a message is one indexed indirect call.
+		constexpr auto standard_handler_table = make_standard_handler_table();
 	}
 
 	std::shared_ptr<message_handler_invoker> message_handler_invoker_factory::make_shared_standard() {
-		auto invoker = std::make_shared<message_handler_invoker>();
-		register_handlers(*invoker);
+		auto invoker = std::make_shared<message_handler_invoker>(standard_handler_table);
 		log(log_level::info, "Generate standard message handler invoker.");
 		return invoker;
 	}
 
 	std::unique_ptr<message_handler_invoker> message_handler_invoker_factory::make_unique_standard() {
-		auto invoker = std::make_unique<message_handler_invoker>();
-		register_handlers(*invoker);
+		auto invoker = std::make_unique<message_handler_invoker>(standard_handler_table);
 		log(log_level::info, "Generate standard message handler invoker.");
 		return invoker;
 	}
@@ -14,9 +14,9 @@ using namespace minimal_serializer;
 using namespace std::string_literals;
 
 namespace pgl {
-	authentication_request_message_handler::handle_return_t authentication_request_message_handler::handle_message(
+	boost::asio::awaitable<authentication_request_message_handler::handle_return_t> authentication_request_message_handler::handle_message(
 		const authentication_request_message& message,
-		const std::shared_ptr<message_handle_parameter> param) {
+		const std::shared_ptr<message_handle_parameter> param) const {
 		const message_parameter_validator parameter_validator(param);
 		// Check status
 		if (param->session_data.is_authenticated()) {
@@ -35,7 +35,7 @@ namespace pgl {
 			log_with_session(log_level::info, param,
 				"Authentication failed. The client api version doesn't match to the server api version. (server api version: ",
 				api_version, ", client api version: ", message.api_version, ")");
-			return {
+			co_return handle_return_t{
 				{
 					{
 						authentication_result::api_version_mismatch, api_version, server_game_version, 0
@@ -51,7 +51,7 @@ namespace pgl {
 			log_with_session(log_level::info, param,
 				"Authentication failed. The client game id doesn't match to the server id version. (server game version: ",
 				server_game_id, ", client game version: ", message.game_id, ")");
-			return {
+			co_return handle_return_t{
 				{
 					{
 						authentication_result::game_id_mismatch, api_version, server_game_version, 0
@@ -67,7 +67,7 @@ namespace pgl {
 			log_with_session(log_level::info, param,
 				"Authentication failed. The client game version doesn't match to the server game version. (server game version: ",
 				server_game_version, ", client game version: ", message.game_version, ")");
-			return {
+			co_return handle_return_t{
 				{
 					{
 						authentication_result::game_version_mismatch, api_version, server_game_version, 0
@@ -93,6 +93,6 @@ namespace pgl {
 		authentication_reply_message reply{
 			authentication_result::success, api_version, server_game_version, player_full_name.tag
 		};
-		return {{reply}, false};
+		co_return handle_return_t{{reply}, false};
 	}
 }
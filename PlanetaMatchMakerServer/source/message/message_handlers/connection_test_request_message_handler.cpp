@@ -12,29 +12,26 @@ using namespace std;
 using namespace boost;
 
 namespace pgl {
-	bool test_connection_tcp(message_handle_parameter& param, const asio::ip::tcp::endpoint& target_endpoint,
+	asio::awaitable<bool> test_connection_tcp(message_handle_parameter& param, const asio::ip::tcp::endpoint& target_endpoint,
 		const std::string& test_text) {
 		const auto time_out_seconds = std::chrono::seconds(
 			param.server_setting.connection_test.connection_check_tcp_time_out_seconds);
 
 		// Try to establish TCP connection
 		asio::ip::tcp::socket socket(param.connection.get_executor());
-		execute_socket_timed_async_operation(socket, time_out_seconds,
-			[&param, &socket, &target_endpoint]() { socket.async_connect(target_endpoint, param.yield); });
+		co_await execute_socket_timed_async_operation(socket, time_out_seconds,
+			socket.async_connect(target_endpoint, asio::use_awaitable));
 
 		// Send test Text
-		execute_socket_timed_async_operation(socket, time_out_seconds,
-			[&param, &socket, &test_text]() { async_write(socket, asio::buffer(test_text), param.yield); });
+		co_await execute_socket_timed_async_operation(socket, time_out_seconds,
+			async_write(socket, asio::buffer(test_text), asio::use_awaitable));
 
 		// Receive reply
-		std::string result_text;
-		execute_socket_timed_async_operation(socket, time_out_seconds,
-			[&param, &socket, &test_text, &result_text]() {
-				asio::streambuf buffer;
-				async_read(socket, buffer, asio::transfer_exactly(test_text.length()), param.yield);
-				auto buffer_sequence = buffer.data();
-                result_text.assign(asio::buffers_begin(buffer_sequence), asio::buffers_end(buffer_sequence));
-			});
+		asio::streambuf buffer;
+		co_await execute_socket_timed_async_operation(socket, time_out_seconds,
+			async_read(socket, buffer, asio::transfer_exactly(test_text.length()), asio::use_awaitable));
+		auto buffer_sequence = buffer.data();
+		const std::string result_text(asio::buffers_begin(buffer_sequence), asio::buffers_end(buffer_sequence));
 		socket.close();
 
 		// Check the reply matches test text
@@ -42,15 +39,41 @@ namespace pgl {
 			log_with_session(log_level::info, param, "Connect to ", target_endpoint,
 				" successfully, but target endpoint replied reply wrong message:\n expected message is \"", test_text,
 				"\", but received \"", result_text, "\".");
-			return false;
+			co_return false;
 		}
 
 		log_with_session(log_level::info, param, "Connect to ",
 			target_endpoint, " successfully");
-		return true;
+		co_return true;
 	}
 
-	bool test_connection_udp(message_handle_parameter& param, const asio::ip::tcp::endpoint& target_endpoint,
+	// Send test text by UDP and return the received reply.
+	asio::awaitable<std::string> exchange_test_text_udp(asio::ip::udp::socket& socket,
+		const asio::ip::tcp::endpoint& target_endpoint, const std::string& test_text) {
+		auto target_endpoint_udp = asio::ip::udp::endpoint(target_endpoint.address(),
+			target_endpoint.port());
+		co_await socket.async_send_to(asio::buffer(test_text), target_endpoint_udp,
+			asio::use_awaitable);
+
+		// std::string::length() returns the length of a string without null character '\0' while the data sent and received includes '\0'.
+		// So We need to add 1 byte to std::string::length().
+		// Additionally, it is possible to receive data whose end character is not '\0' in UDP (data reception from unexpected host, data corruption in transporting, etc.)
+		// In such case, '\0' disappears and we can't determine the end of the string.
+		// To avoid unexpected behavior caused by this, we allocate more 1 byte to the buffer and overwrite the extra byte to '\0' after we receive data.
+		// Therefore, we set the length of buffer test_text.length() + 2.
+		// 
+		// send:    |---test_text.length()---|0|       <- '\0' is included.
+		// receive: |----------data---------------...| <- it is possible to receive unexpected data in UDP.
+		// buffer:  |---test_text.length()---|?|?|     <- the buffer is overwritten by the received data and it is possible that '\0' doesn't exist.
+		// buffer:  |---test_text.length()---|?|0|     <- By putting '\0' to the end of the buffer, we avoid lack of null character.
+		std::vector<char> buffer_data(test_text.length() + 2);
+		const auto buffer = asio::buffer(buffer_data);
+		co_await socket.async_receive_from(buffer, target_endpoint_udp, asio::use_awaitable);
+		buffer_data[buffer_data.size() - 1] = '\0';
+		co_return std::string(buffer_data.data());
+	}
+
+	asio::awaitable<bool> test_connection_udp(message_handle_parameter& param, const asio::ip::tcp::endpoint& target_endpoint,
 		const std::string& test_text) {
 		const auto time_out_seconds = std::chrono::seconds(
 			param.server_setting.connection_test.connection_check_udp_time_out_seconds);
@@ -67,30 +90,8 @@ namespace pgl {
 		for (auto i = 0; i < try_count; ++i) {
 			try {
 				// Send test Text and receive reply
-				std::string result_text;
-				execute_socket_timed_async_operation(socket, time_out_seconds,
-					[&param, &socket, &target_endpoint, &test_text, &result_text]() {
-						auto target_endpoint_udp = asio::ip::udp::endpoint(target_endpoint.address(),
-							target_endpoint.port());
-						socket.async_send_to(asio::buffer(test_text), target_endpoint_udp, param.yield);
-
-						// std::string::length() returns the length of a string without null character '\0' while the data sent and received includes '\0'.
-						// So We need to add 1 byte to std::string::length().
-						// Additionally, it is possible to receive data whose end character is not '\0' in UDP (data reception from unexpected host, data corruption in transporting, etc.)
-						// In such case, '\0' disappears and we can't determine the end of the string.
-						// To avoid unexpected behavior caused by this, we allocate more 1 byte to the buffer and overwrite the extra byte to '\0' after we receive data.
-						// Therefore, we set the length of buffer test_text.length() + 2.
-						// 
-						// send:    |---test_text.length()---|0|       <- '\0' is included.
-						// receive: |----------data---------------...| <- it is possible to receive unexpected data in UDP.
-						// buffer:  |---test_text.length()---|?|?|     <- the buffer is overwritten by the received data and it is possible that '\0' doesn't exist.
-						// buffer:  |---test_text.length()---|?|0|     <- By putting '\0' to the end of the buffer, we avoid lack of null character.
-						std::vector<char> buffer_data(test_text.length() + 2);
-						const auto buffer = asio::buffer(buffer_data);
-						socket.async_receive_from(buffer, target_endpoint_udp, param.yield);
-						buffer_data[buffer_data.size() - 1] = '\0';
-						result_text = reinterpret_cast<const char*>(buffer_data.data());
-					});
+				const auto result_text = co_await execute_socket_timed_async_operation(socket, time_out_seconds,
+					exchange_test_text_udp(socket, target_endpoint, test_text));
 
 				// Check the reply matches test text
 				if (result_text != test_text) {
@@ -122,12 +123,12 @@ namespace pgl {
 				target_endpoint, ".");
 		}
 
-		return is_succeeded;
+		co_return is_succeeded;
 	}
 
-	connection_test_request_message_handler::handle_return_t connection_test_request_message_handler::handle_message(
+	boost::asio::awaitable<connection_test_request_message_handler::handle_return_t> connection_test_request_message_handler::handle_message(
 		const connection_test_request_message& message,
-		std::shared_ptr<message_handle_parameter> param) {
+		std::shared_ptr<message_handle_parameter> param) const {
 		const message_parameter_validator parameter_validator(param);
 
 		// Check port number is valid
@@ -148,10 +149,10 @@ namespace pgl {
 			const std::string test_text = "Hello. This is PMMS.";
 			switch (message.protocol) {
 				case transport_protocol::tcp:
-					reply.succeed = test_connection_tcp(*param, target_endpoint, test_text);
+					reply.succeed = co_await test_connection_tcp(*param, target_endpoint, test_text);
 					break;
 				case transport_protocol::udp:
-					reply.succeed = test_connection_udp(*param, target_endpoint, test_text);
+					reply.succeed = co_await test_connection_udp(*param, target_endpoint, test_text);
 					break;
 				default:
 					const auto error_message = minimal_serializer::generate_string("Indicated protocol \"",
@@ -168,6 +169,6 @@ namespace pgl {
 			}
 		}
 
-		return {{reply}, false};
+		co_return handle_return_t{{reply}, false};
 	}
 }
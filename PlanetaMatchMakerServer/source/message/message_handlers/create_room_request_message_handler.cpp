@@ -13,9 +13,9 @@ using namespace boost;
 using namespace minimal_serializer;
 
 namespace pgl {
-	create_room_request_message_handler::handle_return_t create_room_request_message_handler::handle_message(
+	boost::asio::awaitable<create_room_request_message_handler::handle_return_t> create_room_request_message_handler::handle_message(
 		const create_room_request_message& message,
-		const std::shared_ptr<message_handle_parameter> param) {
+		const std::shared_ptr<message_handle_parameter> param) const {
 		const message_parameter_validator parameter_validator(param);
 
 		auto& room_data_container = param->server_data.get_room_data_container();
@@ -76,7 +76,7 @@ namespace pgl {
 			param->session_data.set_hosting_room_id(reply.room_id);
 
 			// Reply to the client
-			return {{reply}, false};
+			co_return handle_return_t{{reply}, false};
 		}
 		catch (const unique_variable_duplication_error&) {
 			const auto error_message = generate_string("Failed to create new room with player\"",
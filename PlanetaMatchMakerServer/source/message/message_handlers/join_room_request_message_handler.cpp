@@ -5,9 +5,9 @@
 using namespace minimal_serializer;
 
 namespace pgl {
-	join_room_request_message_handler::handle_return_t join_room_request_message_handler::handle_message(
+	boost::asio::awaitable<join_room_request_message_handler::handle_return_t> join_room_request_message_handler::handle_message(
 		const join_room_request_message& message,
-		const std::shared_ptr<message_handle_parameter> param) {
+		const std::shared_ptr<message_handle_parameter> param) const {
 		const message_parameter_validator parameter_validator(param);
 
 		auto& rooms = param->server_data.get_room_data_container();
@@ -63,7 +63,7 @@ namespace pgl {
 			room_data.game_host_endpoint,
 			room_data.game_host_external_id
 		};
-		return {
+		co_return handle_return_t{
 			{reply},
 			true,
 			[param, room_id = message.room_id] {
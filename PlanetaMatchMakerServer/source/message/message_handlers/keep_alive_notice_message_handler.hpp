@@ -7,7 +7,7 @@ namespace pgl {
 	class keep_alive_notice_message_handler
 		final : public message_handler_base<keep_alive_notice_message> {
 	public:
-		handle_return_t handle_message(const keep_alive_notice_message& message,
-			std::shared_ptr<message_handle_parameter> param) override;
+		boost::asio::awaitable<handle_return_t> handle_message(const keep_alive_notice_message& message,
+			std::shared_ptr<message_handle_parameter> param) const override;
 	};
 }
@@ -11,23 +11,41 @@ using namespace boost;
 using namespace minimal_serializer;
 
 namespace pgl {
-	list_room_request_message_handler::handle_return_t list_room_request_message_handler::handle_message(
+	boost::asio::awaitable<list_room_request_message_handler::handle_return_t> list_room_request_message_handler::handle_message(
 		const list_room_request_message& message,
-		const std::shared_ptr<message_handle_parameter> param) {
+		const std::shared_ptr<message_handle_parameter> param) const {
 		const message_parameter_validator parameter_validator(param);
 
 		// Check room group existence
 		const auto& room_data_container = param->server_data.get_room_data_container();
 
+		// Reuse the reply packed for the same request if no room is changed after that
+		auto& reply_cache = param->server_data.get_list_room_reply_cache();
+		const auto is_cacheable = reply_cache.is_enabled() && !message.search_full_name.is_name_assigned() &&
+			!message.search_full_name.is_tag_assigned();
+		const auto room_version = room_data_container.version();
+		const list_room_reply_cache_key cache_key{
+			message.sort_kind, message.search_target_flags, message.start_index, message.count
+		};
+		if (is_cacheable) {
+			if (auto packed_reply = reply_cache.try_get(room_version, cache_key)) {
+				log_with_session(log_level::debug, param, "Reply is found in the cache (hit=", reply_cache.hit_count(),
+					", miss=", reply_cache.miss_count(), ").");
+				co_return handle_return_t{{}, false, {}, std::move(packed_reply)};
+			}
+		}
+
 		// Generate room data list to send
-		std::vector<room_data> matched_data_list;
+		std::vector<room_summary> reply_data_list;
+		size_t matched_room_count = 0;
 		size_t total_room_count = 0;
 		try {
-			auto search_result = room_data_container.search_with_total(message.sort_kind, message.search_target_flags,
-				message.search_full_name);
-			matched_data_list = std::move(search_result.data);
+			auto search_result = room_data_container.search_range_with_total(message.start_index, message.count,
+				message.sort_kind, message.search_target_flags, message.search_full_name);
+			reply_data_list = std::move(search_result.data);
+			matched_room_count = search_result.matched_room_count;
 			total_room_count = search_result.total_room_count;
-			log_with_session(log_level::info, param, matched_data_list.size(),
+			log_with_session(log_level::info, param, matched_room_count,
 				" rooms are matched in ", total_room_count, " rooms.");
 		}
 		catch (out_of_range&) {
@@ -39,11 +57,9 @@ namespace pgl {
 		// Prepare reply header
 		list_room_reply_message reply{};
 		reply.total_room_count = range_checked_static_cast<uint16_t>(total_room_count);
-		reply.matched_room_count = range_checked_static_cast<uint16_t>(matched_data_list.size());
-		reply.reply_room_count = std::min(range_checked_static_cast<uint16_t>(
-				reply.matched_room_count <= message.start_index ? 0 : reply.matched_room_count - message.start_index),
-			message.count);
-		log_with_session(log_level::info, param, matched_data_list.size(),
+		reply.matched_room_count = range_checked_static_cast<uint16_t>(matched_room_count);
+		reply.reply_room_count = range_checked_static_cast<uint16_t>(reply_data_list.size());
+		log_with_session(log_level::info, param, reply_data_list.size(),
 			" rooms are replied from index ", message.start_index, ".");
 
 		// Generate reply bodies separately
@@ -54,15 +70,15 @@ namespace pgl {
 			for (auto j = 0; j < list_room_reply_room_info_count; ++j) {
 				if (const auto reply_data_index = list_room_reply_room_info_count * i + j; reply_data_index < reply.
 					reply_room_count) {
-					const auto matched_data_index = message.start_index + reply_data_index;
+					const auto& reply_data = reply_data_list[reply_data_index];
 					reply.room_info_list[j] = list_room_reply_message::room_info{
-						matched_data_list[matched_data_index].room_id,
-						matched_data_list[matched_data_index].host_player_full_name,
-						matched_data_list[matched_data_index].setting_flags,
-						matched_data_list[matched_data_index].max_player_count,
-						matched_data_list[matched_data_index].current_player_count,
-						matched_data_list[matched_data_index].create_datetime,
-						matched_data_list[matched_data_index].game_host_connection_establish_mode
+						reply_data.room_id,
+						reply_data.host_player_full_name,
+						reply_data.setting_flags,
+						reply_data.max_player_count,
+						reply_data.current_player_count,
+						reply_data.create_datetime,
+						reply_data.game_host_connection_establish_mode
 					};
 				}
 				else { reply.room_info_list[j] = {}; }
@@ -85,6 +101,19 @@ namespace pgl {
 		log_with_session(log_level::info, param, "Finished generating reply bodies ",
 			message_type::list_room, " message by ", separation, " messages.");
 
-		return {reply_bodies, false};
+		if (!is_cacheable) { co_return handle_return_t{reply_bodies, false}; }
+
+		const reply_message_header reply_header{message_type::list_room, message_error_code::ok};
+		auto packed_reply = std::make_shared<std::vector<uint8_t>>();
+		packed_reply->reserve(get_packed_size<reply_message_header, list_room_reply_message>() * reply_bodies.size());
+		for (auto&& reply_body : reply_bodies) {
+			const auto packed_data = pack_data(reply_header, reply_body);
+			packed_reply->insert(packed_reply->end(), packed_data.begin(), packed_data.end());
+		}
+
+		reply_cache.add(room_version, cache_key, packed_reply);
+		log_with_session(log_level::debug, param, "Add the reply to the cache (hit=", reply_cache.hit_count(),
+			", miss=", reply_cache.miss_count(), ").");
+		co_return handle_return_t{{}, false, {}, std::move(packed_reply)};
 	}
 }
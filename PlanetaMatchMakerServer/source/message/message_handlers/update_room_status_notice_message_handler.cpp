@@ -7,9 +7,9 @@
 using namespace minimal_serializer;
 
 namespace pgl {
-	update_room_status_notice_message_handler::handle_return_t
+	boost::asio::awaitable<update_room_status_notice_message_handler::handle_return_t>
 	update_room_status_notice_message_handler::handle_message(const update_room_status_notice_message& message,
-		const std::shared_ptr<message_handle_parameter> param) {
+		const std::shared_ptr<message_handle_parameter> param) const {
 		const message_parameter_validator parameter_validator(param);
 
 		// Check room group existence
@@ -74,6 +74,6 @@ namespace pgl {
 				throw client_error(client_error_code::request_parameter_wrong, false, error_message);
 		}
 
-		return {{}, false};
+		co_return handle_return_t{{}, false};
 	}
 }
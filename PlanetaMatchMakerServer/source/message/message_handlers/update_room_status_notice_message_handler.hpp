@@ -7,7 +7,7 @@ namespace pgl {
 	class update_room_status_notice_message_handler
 		final : public message_handler_base<update_room_status_notice_message> {
 	public:
-		handle_return_t handle_message(const update_room_status_notice_message& message,
-			std::shared_ptr<message_handle_parameter> param) override;
+		boost::asio::awaitable<handle_return_t> handle_message(const update_room_status_notice_message& message,
+			std::shared_ptr<message_handle_parameter> param) const override;
 	};
 }
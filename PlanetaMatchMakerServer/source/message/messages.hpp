@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include "minimal_serializer/serializer.hpp"
@@ -26,6 +27,9 @@ namespace pgl {
 		keep_alive
 	};
 
+	// The number of message types. Update this when a message type is added after keep_alive.
+	constexpr size_t message_type_count = static_cast<size_t>(message_type::keep_alive) + 1;
+
 	// 1 bytes. Use for notice message too
 	struct request_message_header final {
 		message_type message_type;
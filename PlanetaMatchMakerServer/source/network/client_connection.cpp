@@ -5,14 +5,31 @@
 using namespace boost;
 
 namespace pgl {
-	client_connection::client_connection(asio::any_io_executor executor, server_tls_context& tls_context):
-		tls_context_(tls_context), socket_(std::move(executor)) { reset(mode_); }
+	namespace {
+		bool is_ktls_enabled([[maybe_unused]] asio::ssl::context& context) {
+#ifdef SSL_OP_ENABLE_KTLS
+			return (SSL_CTX_get_options(context.native_handle()) & SSL_OP_ENABLE_KTLS) != 0;
+#else
+			return false;
+#endif
+		}
+	}
+
+	client_connection::client_connection(asio::any_io_executor executor, server_tls_context& tls_context,
+		std::shared_ptr<timer_wheel> deadline_wheel, const size_t receive_buffer_capacity): tls_context_(tls_context),
+		socket_(std::move(executor)), counted_socket_(socket_, socket_operation_count_),
+		deadline_wheel_(std::move(deadline_wheel)), deadline_([](void* const context) noexcept {
+			// Cancel the operation which is waited for. It completes with operation_aborted as with a timer.
+			boost::system::error_code ignored_error;
+			static_cast<client_connection*>(context)->cancel(ignored_error);
+		}, this), receive_buffer_(receive_buffer_capacity) { reset(mode_); }
 
 	void client_connection::reset(const server_tls_mode mode) {
 		boost::system::error_code ignored_error;
 		close(ignored_error);
 
 		tls_stream_.reset();
+		ktls_stream_.reset();
 		active_tls_context_.reset();
 		mode_ = mode;
 	}
@@ -29,20 +46,78 @@ namespace pgl {
 
 	asio::ip::tcp::endpoint client_connection::local_endpoint() { return socket().local_endpoint(); }
 
-	void client_connection::async_handshake(const asio::yield_context yield) {
+	asio::awaitable<void> client_connection::async_handshake() {
 		if (is_tls()) {
 			active_tls_context_ = tls_context_.current();
 			if (!active_tls_context_) { throw std::runtime_error("TLS context is not loaded."); }
-			tls_stream_.emplace(socket_, *active_tls_context_);
-			tls_stream_->async_handshake(asio::ssl::stream_base::server, yield);
+			if (is_ktls_enabled(*active_tls_context_)) {
+				ktls_stream_.emplace(*active_tls_context_, socket_, socket_operation_count_);
+				co_await ktls_stream_->async_handshake();
+			}
+			else {
+				tls_stream_.emplace(counted_socket_, *active_tls_context_);
+				co_await tls_stream_->async_handshake(asio::ssl::stream_base::server, asio::use_awaitable);
+			}
+			tls_context_.on_handshake_completed(is_session_resumed());
+		}
+	}
+
+	bool client_connection::is_session_resumed() {
+		if (ktls_stream_) { return SSL_session_reused(ktls_stream_->native_handle()) == 1; }
+		return tls_stream_ && SSL_session_reused(tls_stream_->native_handle()) == 1;
+	}
+
+	const ktls_stream* client_connection::get_ktls_stream() const { return ktls_stream_ ? &*ktls_stream_ : nullptr; }
+
+	asio::awaitable<std::span<const uint8_t>> client_connection::async_receive(const size_t size) {
+		while (receive_buffer_.size() < size) {
+			const auto space = receive_buffer_.prepare(size - receive_buffer_.size());
+			const auto buffer = asio::buffer(space.data(), space.size());
+			size_t received_size;
+			if (ktls_stream_) { received_size = co_await ktls_stream_->async_read_some(buffer); }
+			else if (is_tls()) { received_size = co_await tls_stream_->async_read_some(buffer, asio::use_awaitable); }
+			else { received_size = co_await counted_socket_.async_read_some(buffer, asio::use_awaitable); }
+			receive_buffer_.commit(received_size);
+		}
+
+		co_return receive_buffer_.data();
+	}
+
+	void client_connection::consume_received_data(const size_t size) { receive_buffer_.consume(size); }
+
+	size_t client_connection::received_data_size() const { return receive_buffer_.size(); }
+
+	void client_connection::queue_write(const std::span<const uint8_t> data) {
+		send_queue_.insert(send_queue_.end(), data.begin(), data.end());
+	}
+
+	size_t client_connection::queued_write_size() const { return send_queue_.size(); }
+
+	asio::awaitable<void> client_connection::async_write_queued() {
+		try { co_await async_write(asio::buffer(send_queue_)); }
+		catch (...) {
+			send_queue_.clear();
+			throw;
 		}
+		send_queue_.clear();
+	}
+
+	timer_wheel* client_connection::deadline_wheel() const { return deadline_wheel_.get(); }
+
+	timer_wheel_deadline& client_connection::deadline() { return deadline_; }
+
+	const socket_operation_count& client_connection::get_socket_operation_count() const {
+		return socket_operation_count_;
 	}
 
 	void client_connection::cancel(boost::system::error_code& error_code) { socket().cancel(error_code); }
 
 	void client_connection::close(boost::system::error_code& error_code) {
 		tls_stream_.reset();
+		ktls_stream_.reset();
 		active_tls_context_.reset();
+		receive_buffer_.clear();
+		send_queue_.clear();
 		socket_.close(error_code);
 	}
 }
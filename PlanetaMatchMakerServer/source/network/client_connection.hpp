@@ -2,19 +2,35 @@
 
 #include <optional>
 #include <memory>
+#include <span>
+#include <vector>
 
 #include <boost/asio.hpp>
 #include <boost/asio/ssl.hpp>
-#include <boost/asio/spawn.hpp>
 #include <boost/noncopyable.hpp>
 
 #include "server/server_setting.hpp"
 #include "server/server_tls_context.hpp"
+#include "async/timer_wheel.hpp"
+#include "counted_socket.hpp"
+#include "ktls_stream.hpp"
+#include "receive_buffer.hpp"
 
 namespace pgl {
 	class client_connection final : boost::noncopyable {
 	public:
-		client_connection(boost::asio::any_io_executor executor, server_tls_context& tls_context);
+		// Large enough for a request message header and any request message body.
+		static constexpr size_t default_receive_buffer_capacity = 4096;
+
+		/**
+		 * @param executor An executor of the socket.
+		 * @param tls_context A TLS context.
+		 * @param deadline_wheel A timer wheel which holds send and receive deadlines. nullptr to arm a timer for each operation. The executor must be run by the thread which runs the wheel.
+		 * @param receive_buffer_capacity A capacity of the receive buffer.
+		 */
+		client_connection(boost::asio::any_io_executor executor, server_tls_context& tls_context,
+			std::shared_ptr<timer_wheel> deadline_wheel = nullptr,
+			size_t receive_buffer_capacity = default_receive_buffer_capacity);
 
 		void reset(server_tls_mode mode);
 
@@ -26,36 +42,87 @@ namespace pgl {
 		[[nodiscard]] boost::asio::ip::tcp::endpoint remote_endpoint();
 		[[nodiscard]] boost::asio::ip::tcp::endpoint local_endpoint();
 
-		void async_handshake(boost::asio::yield_context yield);
+		boost::asio::awaitable<void> async_handshake();
+
+		// Whether the last TLS handshake resumed a session instead of a full handshake.
+		[[nodiscard]] bool is_session_resumed();
+
+		// Get a stream of kTLS mode if the TLS context enables kTLS. nullptr otherwise.
+		[[nodiscard]] const ktls_stream* get_ktls_stream() const;
+
 		void cancel(boost::system::error_code& error_code);
 		void close(boost::system::error_code& error_code);
 
 		template <typename ConstBufferSequence>
-		void async_write(const ConstBufferSequence& buffers, boost::asio::yield_context yield) {
-			if (is_tls()) {
-				boost::asio::async_write(*tls_stream_, buffers, yield);
-				return;
+		boost::asio::awaitable<void> async_write(const ConstBufferSequence buffers) {
+			if (ktls_stream_) {
+				const auto end = boost::asio::buffer_sequence_end(buffers);
+				for (auto it = boost::asio::buffer_sequence_begin(buffers); it != end; ++it) {
+					co_await ktls_stream_->async_write(*it);
+				}
+				co_return;
 			}
 
-			boost::asio::async_write(socket_, buffers, yield);
-		}
-
-		template <typename MutableBufferSequence, typename CompletionCondition>
-		void async_read(const MutableBufferSequence& buffers, CompletionCondition completion_condition,
-			boost::asio::yield_context yield) {
 			if (is_tls()) {
-				boost::asio::async_read(*tls_stream_, buffers, completion_condition, yield);
-				return;
+				co_await boost::asio::async_write(*tls_stream_, buffers, boost::asio::use_awaitable);
+				co_return;
 			}
 
-			boost::asio::async_read(socket_, buffers, completion_condition, yield);
+			co_await boost::asio::async_write(counted_socket_, buffers, boost::asio::use_awaitable);
 		}
 
+		/**
+		 * Receive bytes into the receive buffer until size bytes or more are buffered.
+		 * Each read takes as many bytes as are available, so following messages may be buffered together.
+		 *
+		 * @param size The number of bytes required.
+		 * @return Buffered bytes which are not consumed yet. The span is valid until the next receive or consume.
+		 * @throw std::length_error size exceeds the capacity of the receive buffer.
+		 * @throw boost::system::system_error Failed to read.
+		 */
+		boost::asio::awaitable<std::span<const uint8_t>> async_receive(size_t size);
+
+		// Remove bytes from the front of the receive buffer after they are parsed.
+		void consume_received_data(size_t size);
+
+		// Get the number of received bytes which are not consumed yet.
+		[[nodiscard]] size_t received_data_size() const;
+
+		// Append data to the send queue. Queued data is sent by async_write_queued().
+		void queue_write(std::span<const uint8_t> data);
+
+		[[nodiscard]] size_t queued_write_size() const;
+
+		/**
+		 * Write all queued data in one write. The queue is cleared even if the write fails.
+		 *
+		 * @throw boost::system::system_error Failed to write.
+		 */
+		boost::asio::awaitable<void> async_write_queued();
+
+		// Get a timer wheel which holds deadlines of this connection. nullptr if it is not used.
+		[[nodiscard]] timer_wheel* deadline_wheel() const;
+
+		// Get a deadline of the current send, receive or handshake. A session never waits for them at once, so one deadline is enough.
+		[[nodiscard]] timer_wheel_deadline& deadline();
+
+		// Get the numbers of reads and writes issued to the socket including those for TLS. They are not reset by reset() or close().
+		[[nodiscard]] const socket_operation_count& get_socket_operation_count() const;
+
 	private:
 		server_tls_context& tls_context_;
 		server_tls_mode mode_ = server_tls_mode::tls;
 		boost::asio::ip::tcp::socket socket_;
+		socket_operation_count socket_operation_count_;
+		counted_socket counted_socket_;
 		std::shared_ptr<boost::asio::ssl::context> active_tls_context_;
-		std::optional<boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>> tls_stream_;
+		std::optional<boost::asio::ssl::stream<counted_socket>> tls_stream_;
+		// Used instead of tls_stream_ if the TLS context enables kTLS.
+		std::optional<ktls_stream> ktls_stream_;
+		std::shared_ptr<timer_wheel> deadline_wheel_;
+		timer_wheel_deadline deadline_;
+		receive_buffer receive_buffer_;
+		// The capacity is kept after clear, so queueing does not allocate once it reaches the size of the largest batch.
+		std::vector<uint8_t> send_queue_;
 	};
 }
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include <boost/asio.hpp>
+
+namespace pgl {
+	/**
+	 * The numbers of read and write operations issued to a socket.
+	 * An operation is normally one system call. An operation which would block takes one more call after the socket becomes ready.
+	 */
+	struct socket_operation_count final {
+		uint64_t read_count = 0;
+		uint64_t write_count = 0;
+
+		[[nodiscard]] uint64_t total() const { return read_count + write_count; }
+	};
+
+	/**
+	 * A stream which forwards operations to a TCP socket and counts them.
+	 * This is also the next layer of a TLS stream, so reads and writes of TLS records are counted.
+	 * This is not thread safe. Operations must be issued from the executor of the socket.
+	 */
+	class counted_socket final {
+	public:
+		using executor_type = boost::asio::ip::tcp::socket::executor_type;
+		using lowest_layer_type = boost::asio::ip::tcp::socket::lowest_layer_type;
+
+		counted_socket(boost::asio::ip::tcp::socket& socket, socket_operation_count& count) : socket_(&socket),
+			count_(&count) {}
+
+		[[nodiscard]] executor_type get_executor() { return socket_->get_executor(); }
+
+		lowest_layer_type& lowest_layer() { return socket_->lowest_layer(); }
+
+		[[nodiscard]] const lowest_layer_type& lowest_layer() const { return socket_->lowest_layer(); }
+
+		template <typename MutableBufferSequence, typename ReadToken>
+		auto async_read_some(const MutableBufferSequence& buffers, ReadToken&& token) {
+			++count_->read_count;
+			return socket_->async_read_some(buffers, std::forward<ReadToken>(token));
+		}
+
+		template <typename ConstBufferSequence, typename WriteToken>
+		auto async_write_some(const ConstBufferSequence& buffers, WriteToken&& token) {
+			++count_->write_count;
+			return socket_->async_write_some(buffers, std::forward<WriteToken>(token));
+		}
+
+	private:
+		boost::asio::ip::tcp::socket* socket_;
+		socket_operation_count* count_;
+	};
+}
@@ -0,0 +1,122 @@
+#include <cerrno>
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+
+#include "ktls_stream.hpp"
+
+using namespace boost;
+
+namespace pgl {
+	namespace {
+		system::error_code make_ssl_error_code(const int ssl_error, const int saved_errno) {
+			switch (ssl_error) {
+				case SSL_ERROR_ZERO_RETURN:
+					return asio::error::eof;
+				case SSL_ERROR_SYSCALL:
+					if (const auto error = ERR_get_error(); error != 0) {
+						return {static_cast<int>(error), asio::error::get_ssl_category()};
+					}
+					return saved_errno != 0
+						? system::error_code(saved_errno, system::system_category())
+						: system::error_code(asio::error::eof);
+				default: {
+					const auto error = ERR_get_error();
+#ifdef SSL_R_UNEXPECTED_EOF_WHILE_READING
+					if (ERR_GET_REASON(error) == SSL_R_UNEXPECTED_EOF_WHILE_READING) { return asio::error::eof; }
+#endif
+					return {static_cast<int>(error), asio::error::get_ssl_category()};
+				}
+			}
+		}
+	}
+
+	ktls_stream::ktls_stream(asio::ssl::context& context, asio::ip::tcp::socket& socket,
+		socket_operation_count& count): ssl_(SSL_new(context.native_handle())), socket_(socket), count_(count),
+		counted_socket_(socket, count) {
+		if (ssl_ == nullptr) {
+			throw system::system_error(static_cast<int>(ERR_get_error()), asio::error::get_ssl_category(),
+				"SSL_new");
+		}
+
+		// OpenSSL calls read and write on the socket, which must not block the thread.
+		socket_.native_non_blocking(true);
+		// The socket BIO does not close the socket, so the socket is still closed by its owner.
+		if (SSL_set_fd(ssl_, static_cast<int>(socket_.native_handle())) != 1) {
+			SSL_free(ssl_);
+			throw system::system_error(static_cast<int>(ERR_get_error()), asio::error::get_ssl_category(),
+				"SSL_set_fd");
+		}
+		SSL_set_accept_state(ssl_);
+	}
+
+	ktls_stream::~ktls_stream() { SSL_free(ssl_); }
+
+	asio::awaitable<void> ktls_stream::async_handshake() {
+		while (true) {
+			ERR_clear_error();
+			const auto result = SSL_do_handshake(ssl_);
+			if (result == 1) { break; }
+			co_await async_wait_for_retry(result);
+		}
+
+#ifndef OPENSSL_NO_KTLS
+		is_send_offloaded_ = BIO_get_ktls_send(SSL_get_wbio(ssl_));
+		is_receive_offloaded_ = BIO_get_ktls_recv(SSL_get_rbio(ssl_));
+#endif
+	}
+
+	asio::awaitable<size_t> ktls_stream::async_read_some(const asio::mutable_buffer buffer) {
+		// Read by OpenSSL even if the kernel decrypts records. A plain read fails with EIO at a record which is not application data such as close_notify, KeyUpdate or NewSessionTicket, and OpenSSL handles them by the record type which recvmsg reports.
+		while (true) {
+			ERR_clear_error();
+			size_t read_size = 0;
+			++count_.read_count;
+			const auto result = SSL_read_ex(ssl_, buffer.data(), buffer.size(), &read_size);
+			if (result == 1) { co_return read_size; }
+			co_await async_wait_for_retry(result);
+		}
+	}
+
+	asio::awaitable<void> ktls_stream::async_write(const asio::const_buffer buffer) {
+		if (is_send_offloaded_) {
+			co_await asio::async_write(counted_socket_, buffer, asio::use_awaitable);
+			co_return;
+		}
+
+		auto* data = static_cast<const uint8_t*>(buffer.data());
+		auto rest_size = buffer.size();
+		while (rest_size > 0) {
+			ERR_clear_error();
+			size_t written_size = 0;
+			++count_.write_count;
+			const auto result = SSL_write_ex(ssl_, data, rest_size, &written_size);
+			if (result == 1) {
+				data += written_size;
+				rest_size -= written_size;
+				continue;
+			}
+			co_await async_wait_for_retry(result);
+		}
+	}
+
+	bool ktls_stream::is_send_offloaded() const { return is_send_offloaded_; }
+
+	bool ktls_stream::is_receive_offloaded() const { return is_receive_offloaded_; }
+
+	SSL* ktls_stream::native_handle() const { return ssl_; }
+
+	asio::awaitable<void> ktls_stream::async_wait_for_retry(const int result) {
+		const auto saved_errno = errno;
+		switch (const auto ssl_error = SSL_get_error(ssl_, result)) {
+			case SSL_ERROR_WANT_READ:
+				co_await socket_.async_wait(asio::ip::tcp::socket::wait_read, asio::use_awaitable);
+				break;
+			case SSL_ERROR_WANT_WRITE:
+				co_await socket_.async_wait(asio::ip::tcp::socket::wait_write, asio::use_awaitable);
+				break;
+			default:
+				throw system::system_error(make_ssl_error_code(ssl_error, saved_errno));
+		}
+	}
+}
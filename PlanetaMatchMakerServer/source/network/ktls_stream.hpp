@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "counted_socket.hpp"
+
+namespace pgl {
+	/**
+	 * A TLS stream whose OpenSSL object reads and writes the socket directly instead of through memory buffers, so that OpenSSL can install the negotiated keys into kernel TLS (Linux kTLS) after the handshake.
+	 *
+	 * The context must have SSL_OP_ENABLE_KTLS. If the kernel takes over sending, data is written by plain socket I/O. Received data is always read through OpenSSL, which reads records which the kernel decrypted without decrypting them again. If the kernel or the cipher does not support kTLS, both directions are processed in user space.
+	 * This is not thread safe. Operations must be issued from the executor of the socket.
+	 */
+	class ktls_stream final : boost::noncopyable {
+	public:
+		/**
+		 * @param context A TLS context.
+		 * @param socket A connected socket. It is made non-blocking and must outlive this stream.
+		 * @param count The numbers of socket operations. An OpenSSL read or write call is counted as one operation.
+		 * @throw boost::system::system_error Failed to create an OpenSSL object.
+		 */
+		ktls_stream(boost::asio::ssl::context& context, boost::asio::ip::tcp::socket& socket,
+			socket_operation_count& count);
+		~ktls_stream();
+
+		// Handshake as a server, then check which directions are offloaded to the kernel.
+		boost::asio::awaitable<void> async_handshake();
+
+		boost::asio::awaitable<size_t> async_read_some(boost::asio::mutable_buffer buffer);
+
+		boost::asio::awaitable<void> async_write(boost::asio::const_buffer buffer);
+
+		// Whether records to send are encrypted by the kernel.
+		[[nodiscard]] bool is_send_offloaded() const;
+
+		// Whether received records are decrypted by the kernel.
+		[[nodiscard]] bool is_receive_offloaded() const;
+
+		[[nodiscard]] SSL* native_handle() const;
+
+	private:
+		SSL* ssl_;
+		boost::asio::ip::tcp::socket& socket_;
+		socket_operation_count& count_;
+		counted_socket counted_socket_;
+		bool is_send_offloaded_ = false;
+		bool is_receive_offloaded_ = false;
+
+		// Wait until the socket is ready for an OpenSSL call which returned result.
+		// @throw boost::system::system_error The call failed, or the peer closed the connection.
+		boost::asio::awaitable<void> async_wait_for_retry(int result);
+	};
+}
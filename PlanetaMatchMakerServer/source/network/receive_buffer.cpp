@@ -0,0 +1,50 @@
+#include "receive_buffer.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace pgl {
+	receive_buffer::receive_buffer(const size_t capacity) {
+		if (capacity == 0) { throw std::invalid_argument("Capacity of receive_buffer must be greater than 0."); }
+		storage_.resize(capacity);
+	}
+
+	std::span<const uint8_t> receive_buffer::data() const { return {storage_.data() + begin_, end_ - begin_}; }
+
+	size_t receive_buffer::size() const { return end_ - begin_; }
+
+	size_t receive_buffer::capacity() const { return storage_.size(); }
+
+	std::span<uint8_t> receive_buffer::prepare(const size_t min_size) {
+		if (min_size > capacity() - size()) {
+			throw std::length_error("Required space exceeds the capacity of receive_buffer.");
+		}
+
+		if (min_size > storage_.size() - end_) {
+			std::copy(storage_.begin() + static_cast<std::ptrdiff_t>(begin_),
+				storage_.begin() + static_cast<std::ptrdiff_t>(end_), storage_.begin());
+			end_ -= begin_;
+			begin_ = 0;
+		}
+
+		return {storage_.data() + end_, storage_.size() - end_};
+	}
+
+	void receive_buffer::commit(const size_t size) {
+		if (size > storage_.size() - end_) { throw std::out_of_range("Committed size exceeds the space of receive_buffer."); }
+		end_ += size;
+	}
+
+	void receive_buffer::consume(const size_t size) {
+		if (size > this->size()) { throw std::out_of_range("Consumed size exceeds the data of receive_buffer."); }
+		begin_ += size;
+
+		// Rewind to the front when all bytes are consumed so the next receive does not need to move bytes.
+		if (begin_ == end_) { clear(); }
+	}
+
+	void receive_buffer::clear() {
+		begin_ = 0;
+		end_ = 0;
+	}
+}
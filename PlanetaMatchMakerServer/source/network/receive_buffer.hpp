@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+namespace pgl {
+	/**
+	 * A fixed capacity byte buffer which keeps received bytes until they are consumed.
+	 *
+	 * The storage is allocated once at construction, so receiving and consuming data do not allocate.
+	 * Bytes which are not consumed yet are moved to the front only when the space after them is too short.
+	 */
+	class receive_buffer final : boost::noncopyable {
+	public:
+		/**
+		 * Create a receive buffer.
+		 *
+		 * @param capacity The number of bytes which can be buffered.
+		 * @throw std::invalid_argument capacity is 0.
+		 */
+		explicit receive_buffer(size_t capacity);
+
+		// Get received bytes which are not consumed yet.
+		[[nodiscard]] std::span<const uint8_t> data() const;
+
+		[[nodiscard]] size_t size() const;
+
+		[[nodiscard]] size_t capacity() const;
+
+		/**
+		 * Get a writable space after received bytes.
+		 *
+		 * @param min_size The minimum size of the space.
+		 * @return A writable space whose size is min_size or more. Bytes written to it must be committed by commit().
+		 * @throw std::length_error size() + min_size exceeds capacity().
+		 */
+		[[nodiscard]] std::span<uint8_t> prepare(size_t min_size);
+
+		/**
+		 * Make bytes written to the space from prepare() readable.
+		 *
+		 * @param size The number of written bytes.
+		 * @throw std::out_of_range size exceeds the space after received bytes.
+		 */
+		void commit(size_t size);
+
+		/**
+		 * Remove bytes from the front of received bytes.
+		 *
+		 * @param size The number of bytes to remove.
+		 * @throw std::out_of_range size exceeds size().
+		 */
+		void consume(size_t size);
+
+		// Remove all received bytes.
+		void clear();
+
+	private:
+		std::vector<uint8_t> storage_;
+		size_t begin_ = 0;
+		size_t end_ = 0;
+	};
+}
@@ -1,6 +1,31 @@
 #include "transport_layer.hpp"
 
 namespace pgl {
+#ifdef __linux__
+	namespace {
+		// A SettableSocketOption of asio for SO_REUSEPORT, which asio does not provide.
+		class reuse_port_option final {
+		public:
+			explicit reuse_port_option(const bool is_enabled) : value_(is_enabled ? 1 : 0) {}
+
+			template <typename Protocol>
+			[[nodiscard]] int level(const Protocol&) const { return SOL_SOCKET; }
+
+			template <typename Protocol>
+			[[nodiscard]] int name(const Protocol&) const { return SO_REUSEPORT; }
+
+			template <typename Protocol>
+			[[nodiscard]] const int* data(const Protocol&) const { return &value_; }
+
+			template <typename Protocol>
+			[[nodiscard]] size_t size(const Protocol&) const { return sizeof(value_); }
+
+		private:
+			int value_;
+		};
+	}
+#endif
+
 	boost::asio::ip::tcp get_tcp(const ip_version ip_version) {
 		switch (ip_version) {
 			case ip_version::v4:
@@ -12,6 +37,24 @@ namespace pgl {
 		}
 	}
 
+	bool is_reuse_port_supported() {
+#ifdef __linux__
+		return true;
+#else
+		// SO_REUSEPORT of BSD family does not distribute connections.
+		return false;
+#endif
+	}
+
+	void set_reuse_port(boost::asio::ip::tcp::acceptor& acceptor) {
+#ifdef __linux__
+		acceptor.set_option(reuse_port_option(true));
+#else
+		static_cast<void>(acceptor);
+		throw std::runtime_error("SO_REUSEPORT is not supported on this platform.");
+#endif
+	}
+
 	bool is_port_number_valid(const port_number_type port_number) {
 		return 49152 <= port_number && port_number <= 65535;
 	}
@@ -13,6 +13,18 @@ namespace pgl {
 
 	boost::asio::ip::tcp get_tcp(ip_version ip_version);
 
+	// check if sockets with SO_REUSEPORT share a port and the kernel distributes connections among them.
+	bool is_reuse_port_supported();
+
+	/**
+	 * Enable SO_REUSEPORT of an opened acceptor. This must be called before bind.
+	 *
+	 * @param acceptor An opened acceptor.
+	 * @throw std::runtime_error SO_REUSEPORT is not supported on this platform.
+	 * @throw boost::system::system_error Failed to set the option.
+	 */
+	void set_reuse_port(boost::asio::ip::tcp::acceptor& acceptor);
+
 	// check if the port number is valid. (dynamic/private ports are considered as valid port)
 	bool is_port_number_valid(port_number_type port_number);
 }
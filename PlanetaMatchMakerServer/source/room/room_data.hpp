@@ -1,5 +1,8 @@
 #pragma once
+#include <algorithm>
 #include <cstdint>
+#include <functional>
+#include <stdexcept>
 
 #include "datetime/datetime.hpp"
 #include "network/endpoint.hpp"
@@ -38,6 +41,19 @@ namespace pgl {
 		uint8_t current_player_count;
 	};
 
+	// Fields of room_data which room search filters and sorts by and list_room replies. Rooms are scanned in this compact form, and other fields like the password and endpoints are read from room_data only when a player joins.
+	struct room_summary final {
+		datetime create_datetime;
+		room_id_t room_id;
+		player_full_name host_player_full_name;
+		room_setting_flag setting_flags;
+		uint8_t max_player_count;
+		uint8_t current_player_count;
+		game_host_connection_establish_mode game_host_connection_establish_mode;
+	};
+
+	static_assert(sizeof(room_summary) <= 64, "room_summary should fit in a cache line.");
+
 	enum class room_search_target_flag : uint8_t {
 		none = 0,
 		public_room = 1,
@@ -56,12 +72,155 @@ namespace pgl {
 		create_datetime_descending
 	};
 
+	// Whether name is less than other in the order of UTF-8 bytes. This does not allocate memory unlike operator< of fixed string
+	inline bool is_player_name_less(const player_name_t& name, const player_name_t& other) {
+		// Unused bytes are filled with 0, so comparing whole buffers gives same order as comparing strings.
+		return std::ranges::lexicographical_compare(name, other);
+	}
+
+	// Whether name contains search_name as a substring. This does not allocate memory
+	inline bool is_player_name_contained(const player_name_t& name, const player_name_t& search_name) {
+		const auto search_name_size = static_cast<std::ptrdiff_t>(search_name.size());
+		if (search_name_size == 0) { return true; }
+
+		const auto name_begin = name.begin();
+		return !std::ranges::search(name_begin, name_begin + static_cast<std::ptrdiff_t>(name.size()),
+			search_name.begin(), search_name.begin() + search_name_size).empty();
+	}
+
+	// Whether a room with setting_flags matches search_target_flags without considering the search name
+	constexpr bool is_room_setting_flag_matched(const room_search_target_flag search_target_flags,
+		const room_setting_flag setting_flags) {
+		const auto public_flags = (setting_flags & room_setting_flag::public_room) != room_setting_flag::none
+			                          ? room_search_target_flag::public_room
+			                          : room_search_target_flag::private_room;
+		const auto open_flags = (setting_flags & room_setting_flag::open_room) != room_setting_flag::none
+			                        ? room_search_target_flag::open_room
+			                        : room_search_target_flag::closed_room;
+		return (public_flags & search_target_flags) != room_search_target_flag::none
+			&& (open_flags & search_target_flags) != room_search_target_flag::none;
+	}
+
+	// Order room_data or room_summary by the sort key of SortKind. Ties are broken by host player tag or room ID so rooms in different tables are merged in same order
+	template <room_data_sort_kind SortKind>
+	struct room_data_order final {
+		static constexpr auto sort_kind = SortKind;
+
+		template <class RoomData>
+		bool operator()(const RoomData& left, const RoomData& right) const {
+			if constexpr (SortKind == room_data_sort_kind::name_ascending) {
+				const auto& left_name = left.host_player_full_name;
+				const auto& right_name = right.host_player_full_name;
+				if (left_name.name != right_name.name) { return is_player_name_less(left_name.name, right_name.name); }
+				if (left_name.tag != right_name.tag) { return left_name.tag < right_name.tag; }
+				return left.room_id < right.room_id;
+			}
+			else if constexpr (SortKind == room_data_sort_kind::name_descending) {
+				return room_data_order<room_data_sort_kind::name_ascending>{}(right, left);
+			}
+			else if constexpr (SortKind == room_data_sort_kind::create_datetime_ascending) {
+				if (left.create_datetime != right.create_datetime) {
+					return left.create_datetime < right.create_datetime;
+				}
+				return left.room_id < right.room_id;
+			}
+			else {
+				static_assert(SortKind == room_data_sort_kind::create_datetime_descending);
+				return room_data_order<room_data_sort_kind::create_datetime_ascending>{}(right, left);
+			}
+		}
+	};
+
+	// Rooms whose host player name exactly matches search name come first, and others are ordered by Order
+	template <class Order>
+	struct room_data_search_name_priority_order final {
+		player_name_t search_name;
+		Order order;
+
+		template <class RoomData>
+		bool operator()(const RoomData& left, const RoomData& right) const {
+			const auto is_left_matched = left.host_player_full_name.name == search_name;
+			const auto is_right_matched = right.host_player_full_name.name == search_name;
+			if (is_left_matched != is_right_matched) { return is_left_matched; }
+			return order(left, right);
+		}
+	};
+
+	// Filter rooms by setting flags, and by host player name and tag only if they are searched
+	template <bool IsNameSearched, bool IsTagSearched>
+	struct room_data_filter final {
+		room_search_target_flag search_target_flags;
+		player_full_name search_full_name;
+
+		template <class RoomData>
+		bool operator()(const RoomData& data) const {
+			if (!is_room_setting_flag_matched(search_target_flags, data.setting_flags)) { return false; }
+			if constexpr (IsTagSearched) {
+				if (data.host_player_full_name.tag != search_full_name.tag) { return false; }
+			}
+			if constexpr (IsNameSearched) {
+				return is_player_name_contained(data.host_player_full_name.name, search_full_name.name);
+			}
+			return true;
+		}
+	};
+
+	/**
+	 * Call function with room_data_order specialized for sort_kind.
+	 *
+	 * @param sort_kind A kind of sort.
+	 * @param function A function which receives room_data_order.
+	 * @return A value which function returns. function must return same type for all sort kinds.
+	 * @throw std::out_of_range sort_kind is invalid.
+	 */
+	template <typename Function>
+	decltype(auto) visit_room_data_order(const room_data_sort_kind sort_kind, Function&& function) {
+		switch (sort_kind) {
+			case room_data_sort_kind::name_ascending:
+				return function(room_data_order<room_data_sort_kind::name_ascending>{});
+			case room_data_sort_kind::name_descending:
+				return function(room_data_order<room_data_sort_kind::name_descending>{});
+			case room_data_sort_kind::create_datetime_ascending:
+				return function(room_data_order<room_data_sort_kind::create_datetime_ascending>{});
+			case room_data_sort_kind::create_datetime_descending:
+				return function(room_data_order<room_data_sort_kind::create_datetime_descending>{});
+			default:
+				throw std::out_of_range("Invalid room_data_sort_kind.");
+		}
+	}
+
+	/**
+	 * Call function with room_data_filter specialized for whether the name and the tag are searched.
+	 *
+	 * @param search_target_flags A flags of condition to search rooms.
+	 * @param search_full_name A room full name to search.
+	 * @param function A function which receives room_data_filter.
+	 * @return A value which function returns. function must return same type for all filters.
+	 */
+	template <typename Function>
+	decltype(auto) visit_room_data_filter(const room_search_target_flag search_target_flags,
+		const player_full_name& search_full_name, Function&& function) {
+		const auto is_name_searched = search_full_name.is_name_assigned();
+		const auto is_tag_searched = search_full_name.is_tag_assigned();
+		if (is_name_searched && is_tag_searched) {
+			return function(room_data_filter<true, true>{search_target_flags, search_full_name});
+		}
+		if (is_name_searched) { return function(room_data_filter<true, false>{search_target_flags, search_full_name}); }
+		if (is_tag_searched) { return function(room_data_filter<false, true>{search_target_flags, search_full_name}); }
+		return function(room_data_filter<false, false>{search_target_flags, search_full_name});
+	}
+
 	// The room whose name matches search name comes top if search name if not empty
 	std::function<bool(const room_data&, const room_data&)> get_room_data_compare_function(
 		room_data_sort_kind sort_kind, const player_full_name& search_full_name);
 
+	// Unlike compare function, ties are broken by host player tag or room ID so rooms in different tables are merged in same order
+	bool is_room_data_ordered_before(room_data_sort_kind sort_kind, const room_data& left, const room_data& right);
+
 	std::function<bool(const room_data&)> get_room_data_filter_function(room_search_target_flag search_target_flags,
 		const player_full_name& search_full_name);
 
+	room_summary make_room_summary(const room_data& data);
+
 	std::ostream& operator <<(std::ostream& os, const room_data& room_data);
 }
@@ -1,3 +1,187 @@
 ﻿#include "room_data_container.hpp"
 
-namespace pgl { }
+namespace pgl {
+	namespace {
+		// Walk rooms in a partition of a table in the order of sort kind and stop only at rooms which match predicate.
+		template <typename Predicate>
+		class room_table_cursor final {
+		public:
+			room_table_cursor(const room_table& table, const room_setting_flag setting_flags,
+				const room_data_sort_kind sort_kind, const Predicate& predicate) :
+				table_(&table),
+				is_descending_(sort_kind == room_data_sort_kind::name_descending ||
+					sort_kind == room_data_sort_kind::create_datetime_descending),
+				predicate_(&predicate) {
+				const auto& order = table.get_order(setting_flags, sort_kind);
+				// A descending cursor walks backward from the end and its current room is the one before position.
+				position_ = is_descending_ ? order.end() : order.begin();
+				end_ = is_descending_ ? order.begin() : order.end();
+				skip_unmatched();
+			}
+
+			[[nodiscard]] bool is_end() const { return position_ == end_; }
+
+			[[nodiscard]] const room_summary& current() const {
+				return table_->get(is_descending_ ? *std::prev(position_) : *position_);
+			}
+
+			void advance() {
+				move_next();
+				skip_unmatched();
+			}
+
+		private:
+			const room_table* table_;
+			bool is_descending_;
+			const Predicate* predicate_;
+			room_table::order_type::const_iterator position_;
+			room_table::order_type::const_iterator end_;
+
+			void move_next() {
+				if (is_descending_) { --position_; }
+				else { ++position_; }
+			}
+
+			void skip_unmatched() { while (!is_end() && !(*predicate_)(current())) { move_next(); } }
+		};
+
+		// Collect rooms which match filter_function among candidates found by the name index of each table. std::nullopt if the index cannot be used for search_name.
+		template <typename Filter>
+		std::optional<std::vector<const room_summary*>> find_rooms_by_name_index(
+			const std::vector<std::shared_ptr<const room_table>>& tables, const player_name_t& search_name,
+			const Filter& filter_function) {
+			std::vector<const room_summary*> matched_rooms;
+			for (auto&& table : tables) {
+				const auto candidates = table->find_name_candidates(search_name);
+				if (!candidates.has_value()) { return std::nullopt; }
+
+				for (auto&& room_id : *candidates) {
+					if (const auto& data = table->get(room_id); filter_function(data)) { matched_rooms.push_back(&data); }
+				}
+			}
+
+			return matched_rooms;
+		}
+
+		// Merge rooms of matched partitions of all tables which match predicate in the order of Order, and append them to result after skipping skip_count rooms.
+		template <typename Order, typename Predicate>
+		void collect_rooms_in_order(const std::vector<std::shared_ptr<const room_table>>& tables,
+			const std::vector<room_setting_flag>& matched_partitions, const Order& order, const Predicate& predicate,
+			size_t& skip_count, const size_t max_count, std::vector<room_summary>& result) {
+			std::vector<room_table_cursor<Predicate>> cursors;
+			cursors.reserve(tables.size() * matched_partitions.size());
+			for (auto&& table : tables) {
+				for (auto&& setting_flags : matched_partitions) {
+					cursors.emplace_back(*table, setting_flags, Order::sort_kind, predicate);
+				}
+			}
+
+			while (result.size() < max_count) {
+				room_table_cursor<Predicate>* next_cursor = nullptr;
+				for (auto&& cursor : cursors) {
+					if (cursor.is_end()) { continue; }
+					if (next_cursor == nullptr || order(cursor.current(), next_cursor->current())) {
+						next_cursor = &cursor;
+					}
+				}
+
+				if (next_cursor == nullptr) { return; }
+				if (skip_count > 0) { --skip_count; }
+				else { result.push_back(next_cursor->current()); }
+				next_cursor->advance();
+			}
+		}
+
+		// Search rooms in tables with order and filter_function which are specialized at compile time, so they are inlined in loops over rooms.
+		template <typename Order, typename Filter>
+		void search_tables(const std::vector<std::shared_ptr<const room_table>>& tables, const size_t start_index,
+			const size_t count, const room_search_target_flag search_target_flags,
+			const player_full_name& search_full_name, const Order& order, const Filter& filter_function,
+			room_data_container::search_result& result) {
+			if (search_full_name.is_name_assigned()) {
+				if (auto matched_rooms = find_rooms_by_name_index(tables, search_full_name.name, filter_function);
+					matched_rooms.has_value()) {
+					result.matched_room_count = matched_rooms->size();
+					if (start_index >= matched_rooms->size()) { return; }
+
+					// Candidates of the index are few, so sort only the rooms up to the end of the range.
+					const auto end_index = std::min(count, matched_rooms->size() - start_index) + start_index;
+					const room_data_search_name_priority_order<Order> priority_order{search_full_name.name, order};
+					std::partial_sort(matched_rooms->begin(),
+						matched_rooms->begin() + static_cast<std::ptrdiff_t>(end_index), matched_rooms->end(),
+						[&priority_order](const room_summary* left, const room_summary* right) {
+							return priority_order(*left, *right);
+						});
+					result.data.reserve(end_index - start_index);
+					for (auto i = start_index; i < end_index; ++i) { result.data.push_back(*(*matched_rooms)[i]); }
+					return;
+				}
+			}
+
+			// Rooms in partitions whose setting flags match search_target_flags are candidates, so filter_function only has to check the search name.
+			std::vector<room_setting_flag> matched_partitions;
+			std::ranges::copy_if(room_table::partition_setting_flags, std::back_inserter(matched_partitions),
+				[search_target_flags](const room_setting_flag setting_flags) {
+					return is_room_setting_flag_matched(search_target_flags, setting_flags);
+				});
+			const auto is_filtered_by_name = search_full_name.is_name_assigned() || search_full_name.is_tag_assigned();
+			for (auto&& table : tables) {
+				if (is_filtered_by_name) {
+					// Scan room summaries in the order of memory instead of looking up each room in the sorted orders.
+					result.matched_room_count += static_cast<size_t>(std::ranges::count_if(table->rooms(),
+						filter_function));
+					continue;
+				}
+
+				for (auto&& setting_flags : matched_partitions) {
+					result.matched_room_count += table->get_order(setting_flags, Order::sort_kind).size();
+				}
+			}
+
+			if (start_index >= result.matched_room_count) { return; }
+
+			const auto page_size = std::min(count, result.matched_room_count - start_index);
+			result.data.reserve(page_size);
+			auto skip_count = start_index;
+			if (search_full_name.is_name_assigned()) {
+				// Rooms whose host name exactly matches search name come first.
+				const auto exact_match_filter = [&](const room_summary& data) {
+					return data.host_player_full_name.name == search_full_name.name && filter_function(data);
+				};
+				const auto other_filter = [&](const room_summary& data) {
+					return data.host_player_full_name.name != search_full_name.name && filter_function(data);
+				};
+				collect_rooms_in_order(tables, matched_partitions, order, exact_match_filter, skip_count, page_size,
+					result.data);
+				collect_rooms_in_order(tables, matched_partitions, order, other_filter, skip_count, page_size,
+					result.data);
+			}
+			else {
+				collect_rooms_in_order(tables, matched_partitions, order, filter_function, skip_count, page_size,
+					result.data);
+			}
+		}
+	}
+
+	room_data_container::search_result room_data_container::search_range_with_total(const size_t start_index,
+		const size_t count, const room_data_sort_kind sort_kind, const room_search_target_flag search_target_flags,
+		const player_full_name& search_full_name) const {
+		// Keep the tables alive while they are read even if writers publish new ones.
+		std::vector<std::shared_ptr<const room_table>> tables;
+		tables.reserve(shards_.size());
+		search_result result{{}, 0, 0};
+		for (auto&& shard : shards_) {
+			tables.push_back(shard->published_room_table.load(std::memory_order_acquire));
+			result.total_room_count += tables.back()->size();
+		}
+
+		// Select the order and the filter once here instead of calling std::function for each room.
+		visit_room_data_order(sort_kind, [&](const auto order) {
+			visit_room_data_filter(search_target_flags, search_full_name, [&](const auto& filter_function) {
+				search_tables(tables, start_index, count, search_target_flags, search_full_name, order,
+					filter_function, result);
+			});
+		});
+		return result;
+	}
+}
@@ -1,17 +1,29 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <boost/noncopyable.hpp>
+
 #include "data/thread_safe_data_container.hpp"
+#include "data/random_id_generator.hpp"
 #include "client/player_full_name.hpp"
 
 #include "room_constants.hpp"
 #include "room_data.hpp"
+#include "room_data_storage.hpp"
+#include "room_id_codec.hpp"
+#include "room_table.hpp"
 
 namespace pgl {
 	template <class T>
@@ -26,17 +38,23 @@ namespace pgl {
 		{ t.try_assign_id_and_add(room_data(), size_t()) } -> std::convertible_to<std::optional<room_id_t>>;
 		{
 			t.search(room_data_sort_kind(), room_search_target_flag(), player_full_name())
-		} -> std::convertible_to<std::vector<room_data>>;
+		} -> std::convertible_to<std::vector<room_summary>>;
 		{ t.remove(room_id_t()) } -> std::convertible_to<void>;
 	};
 
 	/**
 	 * A thread safe container of room data.
+	 *
+	 * Rooms are split into shards by room ID. Each shard has its own data container and join reservations, so
+	 * operations for rooms in different shards do not wait for each other.
+	 * The uniqueness of host_player_full_name is checked over all shards.
+	 * Each shard publishes an immutable room table after every write, and searches read the published tables without
+	 * taking any lock.
+	 * With the slot map storage, room IDs are issued from slot locations by room_id_codec with a random key, so a room is found by an array access and IDs of removed rooms are rejected.
 	 */
-	class room_data_container final {
+	class room_data_container final : boost::noncopyable {
 	public:
-		using container_type = thread_safe_data_container<room_data, &room_data::room_id, &
-			room_data::host_player_full_name>;
+		using container_type = room_data_storage::hash_map_container_type;
 		using id_type = container_type::id_type;
 		using id_param_type = container_type::id_param_type;
 		using data_param_type = container_type::data_param_type;
@@ -56,17 +74,48 @@ namespace pgl {
 		};
 
 		struct search_result final {
-			std::vector<room_data> data;
+			std::vector<room_summary> data;
+			size_t matched_room_count;
 			size_t total_room_count;
 		};
 
+		/**
+		 * Create a room data container.
+		 *
+		 * @param shard_count The number of shards which rooms are split into by room ID. 1 means rooms are not split.
+		 * @param storage_kind A kind of storage of rooms in each shard.
+		 * @throw std::invalid_argument shard_count is 0.
+		 */
+		explicit room_data_container(const size_t shard_count = 1,
+			const room_storage_kind storage_kind = room_storage_kind::hash_map) {
+			if (shard_count == 0) { throw std::invalid_argument("Shard count of room_data_container must not be 0."); }
+
+			if (storage_kind == room_storage_kind::slot_map) {
+				room_id_codec_.emplace(generate_random_id<uint64_t>(), shard_count);
+			}
+
+			shards_.reserve(shard_count);
+			for (auto i = 0u; i < shard_count; ++i) {
+				shards_.push_back(room_id_codec_.has_value()
+					                  ? std::make_unique<shard>(room_id_codec_->get_shard_key_codec(i))
+					                  : std::make_unique<shard>());
+			}
+		}
+
+		/**
+		 * Get the number of shards.
+		 *
+		 * @return The number of shards.
+		 */
+		[[nodiscard]] size_t shard_count() const { return shards_.size(); }
+
 		/**
 		 * Check if the room data exists with specific ID.
 		 *
 		 * @param id An ID to check existence.
 		 * @return Whether the room exists.
 		 */
-		[[nodiscard]] bool contains(id_param_type id) const { return container_.contains(id); }
+		[[nodiscard]] bool contains(id_param_type id) const { return get_shard(id).container.contains(id); }
 
 		/**
 		 * Get a room data with specific ID.
@@ -74,7 +123,7 @@ namespace pgl {
 		 * @param id An ID to get room data.
 		 * @return A room data.
 		 */
-		[[nodiscard]] room_data get(id_param_type id) const { return container_.get(id); }
+		[[nodiscard]] room_data get(id_param_type id) const { return get_shard(id).container.get(id); }
 
 		/**
 		 * Get a room data with specific ID if it exists.
@@ -82,14 +131,29 @@ namespace pgl {
 		 * @param id An ID to get room data.
 		 * @return A room data. std::nullopt if the room does not exist.
 		 */
-		[[nodiscard]] std::optional<room_data> try_get(id_param_type id) const { return container_.try_get(id); }
+		[[nodiscard]] std::optional<room_data> try_get(id_param_type id) const {
+			return get_shard(id).container.try_get(id);
+		}
 
 		/**
 		 * Get the number of room data.
 		 *
 		 * @return The number of room data.
 		 */
-		[[nodiscard]] size_t size() const { return container_.size(); }
+		[[nodiscard]] size_t size() const {
+			size_t size = 0;
+			for (auto&& shard : shards_) { size += shard->published_room_table.load(std::memory_order_acquire)->size(); }
+			return size;
+		}
+
+		/**
+		 * Get the version of rooms. The version is counted up every time any room is added, updated or removed.
+		 *
+		 * A search started after this returns the version reflects all changes up to the version, so results of same search conditions can be reused while the version is same.
+		 *
+		 * @return The version of rooms.
+		 */
+		[[nodiscard]] uint64_t version() const { return version_.load(std::memory_order_acquire); }
 
 		/**
 		 * Add new room data with ID assigned automatically.
@@ -98,7 +162,7 @@ namespace pgl {
 		 * @throw unique_variable_duplication_error Unique member variable is duplicate.
 		 */
 		room_id_t assign_id_and_add(room_data&& data) {
-			return container_.assign_id_and_add(std::forward<room_data>(data));
+			return *try_assign_id_and_add(std::forward<room_data>(data), std::numeric_limits<size_t>::max());
 		}
 
 		/**
@@ -107,7 +171,7 @@ namespace pgl {
 		 * @param data New room data.
 		 * @throw unique_variable_duplication_error Unique member variable is duplicate.
 		 */
-		room_id_t assign_id_and_add(const room_data& data) { return container_.assign_id_and_add(data); }
+		room_id_t assign_id_and_add(const room_data& data) { return assign_id_and_add(room_data{data}); }
 
 		/**
 		 * Add new room data with ID assigned automatically only if the current room count is below max_size.
@@ -118,7 +182,32 @@ namespace pgl {
 		 * @throw unique_variable_duplication_error Unique member variable is duplicate.
 		 */
 		std::optional<room_id_t> try_assign_id_and_add(room_data&& data, const size_t max_size) {
-			return container_.try_assign_id_and_add(std::forward<room_data>(data), max_size);
+			// Reserve the room count first so the limit is kept without locking all shards.
+			if (!try_increment_room_count(max_size)) { return std::nullopt; }
+
+			try {
+				const auto shard_index = static_cast<size_t>(generate_random_id<id_type>() % shards_.size());
+				auto& shard = *shards_[shard_index];
+				std::lock_guard lock(shard.reservation_mutex);
+				const auto id = generate_room_id_in_shard(shard_index);
+				const auto host_player_full_name = data.host_player_full_name;
+				data.room_id = id;
+				reserve_host_player_full_name(id, host_player_full_name);
+				try {
+					auto table = shard.published_room_table.load(std::memory_order_relaxed)->with_room(data);
+					shard.container.add_or_update(std::move(data));
+					publish_room_table(shard, std::move(table));
+				}
+				catch (...) {
+					remove_host_player_full_name(host_player_full_name);
+					throw;
+				}
+				return id;
+			}
+			catch (...) {
+				room_count_.fetch_sub(1, std::memory_order_acq_rel);
+				throw;
+			}
 		}
 
 		/**
@@ -130,7 +219,7 @@ namespace pgl {
 		 * @throw unique_variable_duplication_error Unique member variable is duplicate.
 		 */
 		std::optional<room_id_t> try_assign_id_and_add(const room_data& data, const size_t max_size) {
-			return container_.try_assign_id_and_add(data, max_size);
+			return try_assign_id_and_add(room_data{data}, max_size);
 		}
 
 		/**
@@ -139,31 +228,29 @@ namespace pgl {
 		 * @param sort_kind A kind of sort for the result list. A room data which exactly matches search_full_name is always located top whatever sort kind is.
 		 * @param search_target_flags A flags of condition to search rooms. Rooms whose status matches some more than or equals one flag will be returned.
 		 * @param search_full_name A room full name to search. Not only full name ("Bill#123") but also tag ("#123"), name ("Bill") or empty string are available.
-		 * @return A list of result room data.
+		 * @return A list of summaries of result rooms.
 		 * @throw std::out_of_range room_data_sort_kind is invalid.
 		 */
-		std::vector<room_data> search(const room_data_sort_kind sort_kind,
+		std::vector<room_summary> search(const room_data_sort_kind sort_kind,
 			const room_search_target_flag search_target_flags,
 			const player_full_name& search_full_name) const {
-			return container_.search(get_room_data_compare_function(sort_kind, search_full_name),
-				get_room_data_filter_function(search_target_flags, search_full_name));
+			return search_with_total(sort_kind, search_target_flags, search_full_name).data;
 		}
 
 		/**
-		 * Search room data and return the total room count from the same locked snapshot.
+		 * Search room data and return the total room count. This takes no lock and reads the room table which each shard published last, so the total room count is the sum of the sizes of those tables.
 		 *
 		 * @param sort_kind A kind of sort for the result list. A room data which exactly matches search_full_name is always located top whatever sort kind is.
 		 * @param search_target_flags A flags of condition to search rooms. Rooms whose status matches some more than or equals one flag will be returned.
 		 * @param search_full_name A room full name to search. Not only full name ("Bill#123") but also tag ("#123"), name ("Bill") or empty string are available.
-		 * @return A list of result room data and the total room count at the time the list was collected.
+		 * @return A list of summaries of result rooms and the total room count at the time the list was collected.
 		 * @throw std::out_of_range room_data_sort_kind is invalid.
 		 */
 		search_result search_with_total(const room_data_sort_kind sort_kind,
 			const room_search_target_flag search_target_flags,
 			const player_full_name& search_full_name) const {
-			auto result = container_.search_with_total(get_room_data_compare_function(sort_kind, search_full_name),
-				get_room_data_filter_function(search_target_flags, search_full_name));
-			return { std::move(result.data), result.total_count };
+			return search_range_with_total(0, std::numeric_limits<size_t>::max(), sort_kind, search_target_flags,
+				search_full_name);
 		}
 
 		/**
@@ -174,29 +261,65 @@ namespace pgl {
 		 * @param sort_kind A kind of sort for the result list. A room data which exactly matches search_full_name is always located top whatever sort kind is.
 		 * @param search_target_flags A flags of condition to search rooms. Rooms whose status matches some more than or equals one flag will be returned.
 		 * @param search_full_name A room full name to search. Not only full name ("Bill#123") but also tag ("#123"), name ("Bill") or empty string are available.
-		 * @return A list of result room data.
+		 * @return A list of summaries of result rooms.
 		 * @throw std::out_of_range room_data_sort_kind is invalid.
 		 */
-		std::vector<room_data> search_range(const int start_idx, const int count,
+		std::vector<room_summary> search_range(const int start_idx, const int count,
 			const room_data_sort_kind sort_kind, const room_search_target_flag search_target_flags,
 			const player_full_name& search_full_name) const {
-			return container_.search_range(start_idx, count,
-				get_room_data_compare_function(sort_kind, search_full_name),
-				get_room_data_filter_function(search_target_flags, search_full_name));
+			return search_range_with_total(static_cast<size_t>(start_idx), static_cast<size_t>(count), sort_kind,
+				search_target_flags, search_full_name).data;
 		}
 
+		/**
+		 * Search room data with range and return the matched room count and the total room count.
+		 * Rooms are walked in the sorted orders which room tables keep, so only rooms before the end of the range are visited in order.
+		 *
+		 * @param start_index A start index of range.
+		 * @param count The number of data in range.
+		 * @param sort_kind A kind of sort for the result list. A room data which exactly matches search_full_name is always located top whatever sort kind is.
+		 * @param search_target_flags A flags of condition to search rooms. Rooms whose status matches some more than or equals one flag will be returned.
+		 * @param search_full_name A room full name to search. Not only full name ("Bill#123") but also tag ("#123"), name ("Bill") or empty string are available.
+		 * @return A list of summaries of result rooms in range, the number of all matched rooms and the total room count at the time the list was collected.
+		 * @throw std::out_of_range room_data_sort_kind is invalid.
+		 */
+		search_result search_range_with_total(size_t start_index, size_t count, room_data_sort_kind sort_kind,
+			room_search_target_flag search_target_flags, const player_full_name& search_full_name) const;
+
 		/**
 		 * Add or update room.
 		 *
 		 * @param data A room data rvalue reference to update.
 		 * @throw unique_variable_duplication_error Unique member variable is duplicated.
+		 * @throw std::invalid_argument The slot map storage is used and the room ID of new room is not issued by it.
 		 * @return true if added.
 		*/
 		bool add_or_update(room_data&& data) {
 			const auto id = data.room_id;
-			std::lock_guard lock(reservation_mutex_);
-			const auto result = container_.add_or_update(std::forward<room_data>(data));
-			reserved_player_count_map_.erase(id);
+			auto& shard = get_shard(id);
+			std::lock_guard lock(shard.reservation_mutex);
+			const auto previous_room_data = shard.container.try_get(id);
+			if (!previous_room_data.has_value() && shard.container.next_id().value_or(id) != id) {
+				throw std::invalid_argument("The room ID is not issued by the slot map storage.");
+			}
+			// The previous name is released only after the room is updated, so a failed update leaves names as they were.
+			const auto host_player_full_name = data.host_player_full_name;
+			const auto is_host_player_full_name_reserved = reserve_host_player_full_name(id, host_player_full_name);
+			bool result;
+			try {
+				auto table = shard.published_room_table.load(std::memory_order_relaxed)->with_room(data);
+				result = shard.container.add_or_update(std::forward<room_data>(data));
+				publish_room_table(shard, std::move(table));
+			}
+			catch (...) {
+				if (is_host_player_full_name_reserved) { remove_host_player_full_name(host_player_full_name); }
+				throw;
+			}
+			if (previous_room_data.has_value() && previous_room_data->host_player_full_name != host_player_full_name) {
+				remove_host_player_full_name(previous_room_data->host_player_full_name);
+			}
+			if (result) { room_count_.fetch_add(1, std::memory_order_acq_rel); }
+			shard.reserved_player_count_map.erase(id);
 			return result;
 		}
 
@@ -220,9 +343,10 @@ namespace pgl {
 		join_room_result_data try_reserve_player_for_join(id_param_type id,
 			const game_host_connection_establish_mode connection_establish_mode,
 			const room_password_t& password) {
-			std::lock_guard lock(reservation_mutex_);
+			auto& shard = get_shard(id);
+			std::lock_guard lock(shard.reservation_mutex);
 			auto result = join_room_result_data{ join_room_result::room_not_found, std::nullopt };
-			const auto updated_room_data = container_.try_update(id, [&](auto& target_room_data) {
+			const auto updated_room_data = shard.container.try_update(id, [&](auto& target_room_data) {
 				if (target_room_data.game_host_connection_establish_mode != connection_establish_mode) {
 					result = { join_room_result::connection_establish_mode_mismatch, target_room_data };
 					return;
@@ -246,12 +370,15 @@ namespace pgl {
 
 				// Reserve capacity immediately until a later host status notice confirms the joining player.
 				++target_room_data.current_player_count;
-				++reserved_player_count_map_[id];
+				++shard.reserved_player_count_map[id];
 				result = { join_room_result::accepted, target_room_data };
 			});
 
 			if (!updated_room_data.has_value()) { return result; }
-			if (result.result == join_room_result::accepted) { result.room = updated_room_data; }
+			if (result.result == join_room_result::accepted) {
+				result.room = updated_room_data;
+				publish_room(shard, *updated_room_data);
+			}
 			return result;
 		}
 
@@ -262,18 +389,23 @@ namespace pgl {
 		 * when the server knows the join client did not receive the host endpoint.
 		 */
 		bool try_release_player_join_reservation(id_param_type id) {
-			std::lock_guard lock(reservation_mutex_);
+			auto& shard = get_shard(id);
+			std::lock_guard lock(shard.reservation_mutex);
 			auto is_released = false;
-			const auto updated_room_data = container_.try_update(id, [&](auto& target_room_data) {
-				const auto reservation_it = reserved_player_count_map_.find(id);
-				if (reservation_it == reserved_player_count_map_.end() || reservation_it->second == 0) { return; }
+			const auto updated_room_data = shard.container.try_update(id, [&](auto& target_room_data) {
+				auto& reserved_player_count_map = shard.reserved_player_count_map;
+				const auto reservation_it = reserved_player_count_map.find(id);
+				if (reservation_it == reserved_player_count_map.end() || reservation_it->second == 0) { return; }
 
 				--reservation_it->second;
 				if (target_room_data.current_player_count > 0) { --target_room_data.current_player_count; }
-				if (reservation_it->second == 0) { reserved_player_count_map_.erase(reservation_it); }
+				if (reservation_it->second == 0) { reserved_player_count_map.erase(reservation_it); }
 				is_released = true;
 			});
-			return updated_room_data.has_value() && is_released;
+			if (!updated_room_data.has_value() || !is_released) { return false; }
+
+			publish_room(shard, *updated_room_data);
+			return true;
 		}
 
 		/**
@@ -284,18 +416,26 @@ namespace pgl {
 		 * The server increments current_player_count before the joining client reaches the host. A host status notice
 		 * generated from an older snapshot must not erase that reservation, otherwise concurrent join requests can be
 		 * over-accepted.
+		 *
+		 * update_function must not change host_player_full_name.
 		 */
 		template <typename UpdateFunction>
 		std::optional<room_data> try_update_with_host_reported_current_player_count(id_param_type id,
 			const bool is_current_player_count_changed, const uint8_t host_current_player_count,
 			UpdateFunction&& update_function) {
-			std::lock_guard lock(reservation_mutex_);
-			return container_.try_update(id, [&](auto& target_room_data) {
+			auto& shard = get_shard(id);
+			std::lock_guard lock(shard.reservation_mutex);
+			auto result = shard.container.try_update(id, [&](auto& target_room_data) {
+				[[maybe_unused]] const auto host_player_full_name = target_room_data.host_player_full_name;
 				update_function(target_room_data);
+				assert(target_room_data.host_player_full_name == host_player_full_name);
 				if (is_current_player_count_changed) {
-					apply_host_reported_current_player_count(id, target_room_data, host_current_player_count);
+					apply_host_reported_current_player_count(shard.reserved_player_count_map, id, target_room_data,
+						host_current_player_count);
 				}
 			});
+			if (result.has_value()) { publish_room(shard, *result); }
+			return result;
 		}
 
 		/**
@@ -305,10 +445,7 @@ namespace pgl {
 		 * @return true if removed.
 		 */
 		bool try_remove(id_param_type id) {
-			std::lock_guard lock(reservation_mutex_);
-			const auto result = container_.try_remove(id);
-			if (result) { reserved_player_count_map_.erase(id); }
-			return result;
+			return try_remove_if(id, [](const auto&) { return true; }).has_value();
 		}
 
 		/**
@@ -320,22 +457,118 @@ namespace pgl {
 		 */
 		template <typename RemoveFunction>
 		std::optional<room_data> try_remove_if(id_param_type id, RemoveFunction&& remove_function) {
-			std::lock_guard lock(reservation_mutex_);
-			auto result = container_.try_remove_if(id, std::forward<RemoveFunction>(remove_function));
-			if (result.has_value()) { reserved_player_count_map_.erase(id); }
+			auto& shard = get_shard(id);
+			std::lock_guard lock(shard.reservation_mutex);
+			auto result = shard.container.try_remove_if(id, std::forward<RemoveFunction>(remove_function));
+			if (result.has_value()) {
+				unpublish_room(shard, id);
+				shard.reserved_player_count_map.erase(id);
+				remove_host_player_full_name(result->host_player_full_name);
+				room_count_.fetch_sub(1, std::memory_order_acq_rel);
+			}
 			return result;
 		}
 
 	private:
-		container_type container_;
-		std::unordered_map<id_type, uint8_t> reserved_player_count_map_;
-		mutable std::mutex reservation_mutex_;
+		// All writes to a shard are serialized by reservation_mutex so join reservations stay consistent with room data.
+		struct shard final : boost::noncopyable {
+			shard() = default;
+
+			explicit shard(const room_shard_key_codec& key_codec) : container(key_codec) {}
+
+			room_data_storage container;
+			// Replaced with a new table by writers under reservation_mutex. Readers load it without any lock.
+			std::atomic<std::shared_ptr<const room_table>> published_room_table{std::make_shared<const room_table>()};
+			std::unordered_map<id_type, uint8_t> reserved_player_count_map;
+			std::mutex reservation_mutex;
+		};
+
+		// Only set for the slot map storage.
+		std::optional<room_id_codec> room_id_codec_;
+		std::vector<std::unique_ptr<shard>> shards_;
+		// Checks that host_player_full_name is unique over all shards.
+		// Only room creation, removal and add_or_update take this lock because host_player_full_name is never changed by room updates.
+		std::unordered_map<player_full_name, id_type> host_player_full_name_map_;
+		std::mutex host_player_full_name_mutex_;
+		// The number of rooms including ones which are being added.
+		std::atomic<size_t> room_count_{0};
+		std::atomic<uint64_t> version_{0};
+
+		[[nodiscard]] shard& get_shard(id_param_type id) const { return *shards_[get_shard_index(id)]; }
+
+		[[nodiscard]] size_t get_shard_index(id_param_type id) const {
+			return room_id_codec_.has_value() ? room_id_codec_->decode(id).shard_index : id % shards_.size();
+		}
+
+		bool try_increment_room_count(const size_t max_size) {
+			auto room_count = room_count_.load(std::memory_order_acquire);
+			do { if (room_count >= max_size) { return false; } }
+			while (!room_count_.compare_exchange_weak(room_count, room_count + 1, std::memory_order_acq_rel,
+				std::memory_order_acquire));
+			return true;
+		}
+
+		// The lock of the shard must be held.
+		[[nodiscard]] id_type generate_room_id_in_shard(const size_t shard_index) const {
+			const auto& shard = *shards_[shard_index];
+			if (const auto next_id = shard.container.next_id(); next_id.has_value()) { return *next_id; }
+
+			// Build an ID whose remainder by the shard count is the shard index, so every drawn ID belongs to the shard.
+			const auto shard_count = static_cast<id_type>(shards_.size());
+			const auto id_shard_index = static_cast<id_type>(shard_index);
+			const auto max_quotient = static_cast<id_type>((std::numeric_limits<id_type>::max() - id_shard_index) /
+				shard_count);
+			id_type quotient{};
+			id_type id{};
+			do {
+				quotient = static_cast<id_type>(generate_random_id<id_type>() / shard_count);
+				id = static_cast<id_type>(quotient * shard_count + id_shard_index);
+			}
+			while (quotient > max_quotient || shard.container.contains(id));
+			return id;
+		}
+
+		// The lock of the shard must be held.
+		void publish_room_table(shard& shard, std::shared_ptr<const room_table>&& table) {
+			shard.published_room_table.store(std::move(table), std::memory_order_release);
+			// Count up after the table is published so a reader which sees the new version always sees the new table.
+			version_.fetch_add(1, std::memory_order_acq_rel);
+		}
+
+		// The lock of the shard must be held.
+		void publish_room(shard& shard, const room_data& data) {
+			publish_room_table(shard, shard.published_room_table.load(std::memory_order_relaxed)->with_room(data));
+		}
+
+		// The lock of the shard must be held.
+		void unpublish_room(shard& shard, id_param_type id) {
+			publish_room_table(shard, shard.published_room_table.load(std::memory_order_relaxed)->without_room(id));
+		}
+
+		/**
+		 * Reserve a host player full name for a room. The lock of the shard which holds the room must be held.
+		 *
+		 * @return true if the name is newly reserved. false if the name is already reserved for the room.
+		 * @throw unique_variable_duplication_error The name is reserved for another room.
+		 */
+		bool reserve_host_player_full_name(id_param_type id, const player_full_name& host_player_full_name) {
+			std::lock_guard lock(host_player_full_name_mutex_);
+			const auto [it, is_inserted] = host_player_full_name_map_.try_emplace(host_player_full_name, id);
+			if (!is_inserted && it->second != id) { throw unique_variable_duplication_error(); }
+			return is_inserted;
+		}
+
+		void remove_host_player_full_name(const player_full_name& host_player_full_name) {
+			std::lock_guard lock(host_player_full_name_mutex_);
+			host_player_full_name_map_.erase(host_player_full_name);
+		}
 
-		void apply_host_reported_current_player_count(id_param_type id, room_data& target_room_data,
-			const uint8_t host_current_player_count) {
+		static void apply_host_reported_current_player_count(
+			std::unordered_map<id_type, uint8_t>& reserved_player_count_map, id_param_type id,
+			room_data& target_room_data, const uint8_t host_current_player_count) {
 			const auto reported_player_count = std::min<uint16_t>(host_current_player_count,
 				target_room_data.max_player_count);
-			auto& stored_reservation_count = reserved_player_count_map_[id];
+			auto& stored_reservation_count = reserved_player_count_map[id];
 			const auto reservation_count = std::min<uint16_t>(stored_reservation_count,
 				target_room_data.current_player_count);
 			stored_reservation_count = static_cast<uint8_t>(reservation_count);
@@ -354,7 +587,7 @@ namespace pgl {
 				target_room_data.max_player_count,
 				reported_player_count + stored_reservation_count);
 			target_room_data.current_player_count = static_cast<uint8_t>(effective_player_count);
-			if (stored_reservation_count == 0) { reserved_player_count_map_.erase(id); }
+			if (stored_reservation_count == 0) { reserved_player_count_map.erase(id); }
 		}
 	};
 }
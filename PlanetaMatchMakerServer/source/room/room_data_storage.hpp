@@ -0,0 +1,110 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <variant>
+
+#include <boost/noncopyable.hpp>
+
+#include "data/slot_map.hpp"
+#include "data/thread_safe_data_container.hpp"
+
+#include "room_constants.hpp"
+#include "room_data.hpp"
+#include "room_id_codec.hpp"
+
+namespace pgl {
+	enum class room_storage_kind : uint8_t {
+		// Rooms are stored in a hash map with random room IDs.
+		hash_map,
+		// Rooms are stored in a slot map and room IDs are issued from slot locations.
+		slot_map
+	};
+
+	/**
+	 * A thread safe storage of room data of one shard whose backend is selected at construction.
+	 *
+	 * The slot map backend finds a room by an array access and detects stale room IDs by generations of slots, but it accepts only room IDs which it issued.
+	 */
+	class room_data_storage final : boost::noncopyable {
+	public:
+		using hash_map_container_type = thread_safe_data_container<room_data, &room_data::room_id>;
+		using slot_map_container_type = basic_thread_safe_data_container<
+			slot_map<room_id_t, room_data, room_shard_key_codec>, room_data, &room_data::room_id>;
+		using id_param_type = hash_map_container_type::id_param_type;
+
+	private:
+		std::variant<hash_map_container_type, slot_map_container_type> container_;
+
+		// Defined before callers because the return type is deduced.
+		template <typename Function>
+		decltype(auto) visit_container(Function&& function) const {
+			return std::visit(std::forward<Function>(function), container_);
+		}
+
+		template <typename Function>
+		decltype(auto) visit_container(Function&& function) {
+			return std::visit(std::forward<Function>(function), container_);
+		}
+
+	public:
+
+		// Create a storage with the hash map backend.
+		room_data_storage() = default;
+
+		// Create a storage with the slot map backend.
+		explicit room_data_storage(const room_shard_key_codec& key_codec) : container_(
+			std::in_place_type<slot_map_container_type>,
+			slot_map<room_id_t, room_data, room_shard_key_codec>(key_codec)) {}
+
+		[[nodiscard]] bool contains(id_param_type id) const {
+			return visit_container([id](const auto& container) { return container.contains(id); });
+		}
+
+		[[nodiscard]] room_data get(id_param_type id) const {
+			return visit_container([id](const auto& container) { return container.get(id); });
+		}
+
+		[[nodiscard]] std::optional<room_data> try_get(id_param_type id) const {
+			return visit_container([id](const auto& container) { return container.try_get(id); });
+		}
+
+		/**
+		 * Get the room ID which the backend issues for the next room.
+		 *
+		 * @return The room ID of the next room. std::nullopt if the backend does not issue room IDs.
+		 * @throw std::length_error No more room can be added to the slot map.
+		 */
+		[[nodiscard]] std::optional<room_id_t> next_id() const {
+			return visit_container([]<typename Container>(const Container& container) -> std::optional<room_id_t> {
+				if constexpr (std::is_same_v<Container, slot_map_container_type>) { return container.next_id(); }
+				else { return std::nullopt; }
+			});
+		}
+
+		/**
+		 * Add or update room.
+		 *
+		 * @param data A room data rvalue reference to update.
+		 * @return true if added.
+		 * @throw std::invalid_argument The backend is the slot map and the room ID is neither existing nor next_id().
+		 */
+		bool add_or_update(room_data&& data) {
+			return visit_container([&data](auto& container) { return container.add_or_update(std::move(data)); });
+		}
+
+		template <typename UpdateFunction>
+		std::optional<room_data> try_update(id_param_type id, UpdateFunction&& update_function) {
+			return visit_container([&](auto& container) {
+				return container.try_update(id, std::forward<UpdateFunction>(update_function));
+			});
+		}
+
+		template <typename RemoveFunction>
+		std::optional<room_data> try_remove_if(id_param_type id, RemoveFunction&& remove_function) {
+			return visit_container([&](auto& container) {
+				return container.try_remove_if(id, std::forward<RemoveFunction>(remove_function));
+			});
+		}
+	};
+}
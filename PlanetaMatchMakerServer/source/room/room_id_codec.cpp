@@ -0,0 +1,76 @@
+#include <stdexcept>
+
+#include "room_id_codec.hpp"
+
+namespace pgl {
+	namespace {
+		// splitmix64 spreads bits of the key into round keys.
+		uint64_t mix_key(uint64_t& state) {
+			auto value = state += 0x9e3779b97f4a7c15;
+			value = (value ^ value >> 30) * 0xbf58476d1ce4e5b9;
+			value = (value ^ value >> 27) * 0x94d049bb133111eb;
+			return value ^ value >> 31;
+		}
+	}
+
+	room_id_codec::room_id_codec(uint64_t key, const size_t shard_count) : round_keys_(), shard_count_(shard_count) {
+		if (shard_count == 0 || shard_count > (1u << global_slot_index_bit_count)) {
+			throw std::invalid_argument("Shard count of room_id_codec is out of range.");
+		}
+
+		for (auto&& round_key : round_keys_) { round_key = static_cast<uint32_t>(mix_key(key)); }
+	}
+
+	room_id_t room_id_codec::encode(const location& location) const {
+		const auto global_slot_index = static_cast<uint32_t>(location.slot.index * shard_count_ + location.shard_index);
+		const auto generation = location.slot.generation & ((1u << generation_bit_count) - 1);
+		return permute(global_slot_index << generation_bit_count | generation);
+	}
+
+	room_id_codec::location room_id_codec::decode(const room_id_t room_id) const {
+		const auto value = unpermute(room_id);
+		const auto global_slot_index = value >> generation_bit_count;
+		return {
+			global_slot_index % shard_count_,
+			{
+				static_cast<uint32_t>(global_slot_index / shard_count_),
+				value & ((1u << generation_bit_count) - 1)
+			}
+		};
+	}
+
+	size_t room_id_codec::max_slot_count() const { return (size_t{1} << global_slot_index_bit_count) / shard_count_; }
+
+	room_shard_key_codec room_id_codec::get_shard_key_codec(const size_t shard_index) const {
+		return {*this, shard_index};
+	}
+
+	uint16_t room_id_codec::round_function(const uint16_t value, const uint32_t round_key) {
+		auto mixed = (value ^ round_key) * 0x9e3779b1u;
+		mixed ^= mixed >> 15;
+		mixed *= 0x85ebca6bu;
+		return static_cast<uint16_t>(mixed >> 16);
+	}
+
+	uint32_t room_id_codec::permute(const uint32_t value) const {
+		auto left = static_cast<uint16_t>(value >> 16);
+		auto right = static_cast<uint16_t>(value);
+		for (auto&& round_key : round_keys_) {
+			const auto next_right = static_cast<uint16_t>(left ^ round_function(right, round_key));
+			left = right;
+			right = next_right;
+		}
+		return static_cast<uint32_t>(left) << 16 | right;
+	}
+
+	uint32_t room_id_codec::unpermute(const uint32_t value) const {
+		auto left = static_cast<uint16_t>(value >> 16);
+		auto right = static_cast<uint16_t>(value);
+		for (auto it = round_keys_.rbegin(); it != round_keys_.rend(); ++it) {
+			const auto previous_left = static_cast<uint16_t>(right ^ round_function(left, *it));
+			right = left;
+			left = previous_left;
+		}
+		return static_cast<uint32_t>(left) << 16 | right;
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "data/slot_map.hpp"
+
+#include "room_constants.hpp"
+
+namespace pgl {
+	class room_shard_key_codec;
+
+	/**
+	 * A converter between room IDs and locations of rooms in slot maps of shards.
+	 *
+	 * The index of the shard, the index of the slot and the generation of the slot are packed into 32 bits and permuted by a keyed Feistel network.
+	 * So room IDs are not sequential and clients cannot guess IDs of other rooms without the key, while a room ID can be decoded without any table.
+	 * This is not a cryptographic cipher. It only makes IDs hard to guess.
+	 */
+	class room_id_codec final {
+	public:
+		// The generation wraps at 2^generation_bit_count, so a stale room ID may find a new room only after the slot is reused that many times.
+		static constexpr uint32_t generation_bit_count = 12;
+		static constexpr uint32_t global_slot_index_bit_count = 32 - generation_bit_count;
+
+		struct location final {
+			size_t shard_index;
+			slot_location slot;
+		};
+
+		/**
+		 * Create a room ID codec.
+		 *
+		 * @param key A secret key to permute room IDs.
+		 * @param shard_count The number of shards.
+		 * @throw std::invalid_argument shard_count is 0 or too large to leave slots for each shard.
+		 */
+		room_id_codec(uint64_t key, size_t shard_count);
+
+		/**
+		 * Encode a location of a room into a room ID.
+		 *
+		 * @param location A location of the room. The slot index must be less than max_slot_count().
+		 * @return A room ID.
+		 */
+		[[nodiscard]] room_id_t encode(const location& location) const;
+
+		/**
+		 * Decode a room ID into a location. The result is meaningless if the room ID is not made by encode.
+		 *
+		 * @param room_id A room ID.
+		 * @return A location of the room.
+		 */
+		[[nodiscard]] location decode(room_id_t room_id) const;
+
+		/**
+		 * Get the number of slots which each shard can have.
+		 *
+		 * @return The number of slots in a shard.
+		 */
+		[[nodiscard]] size_t max_slot_count() const;
+
+		/**
+		 * Make a key codec for the slot map of a shard.
+		 *
+		 * @param shard_index An index of the shard.
+		 * @return A key codec.
+		 */
+		[[nodiscard]] room_shard_key_codec get_shard_key_codec(size_t shard_index) const;
+
+	private:
+		static constexpr size_t round_count = 4;
+
+		std::array<uint32_t, round_count> round_keys_;
+		size_t shard_count_;
+
+		[[nodiscard]] static uint16_t round_function(uint16_t value, uint32_t round_key);
+
+		[[nodiscard]] uint32_t permute(uint32_t value) const;
+
+		[[nodiscard]] uint32_t unpermute(uint32_t value) const;
+	};
+
+	/**
+	 * A key codec of the slot map of one shard.
+	 */
+	class room_shard_key_codec final {
+	public:
+		room_shard_key_codec(const room_id_codec& codec, const size_t shard_index) : codec_(codec),
+			shard_index_(shard_index) {}
+
+		[[nodiscard]] room_id_t encode(const slot_location& slot) const { return codec_.encode({shard_index_, slot}); }
+
+		[[nodiscard]] slot_location decode(const room_id_t room_id) const { return codec_.decode(room_id).slot; }
+
+		[[nodiscard]] size_t max_slot_count() const { return codec_.max_slot_count(); }
+
+	private:
+		room_id_codec codec_;
+		size_t shard_index_;
+	};
+}
@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "room_table.hpp"
+
+namespace pgl {
+	room_table::room_table() {
+		for (auto&& partition_orders : orders_) {
+			for (auto&& order : partition_orders) { order = std::make_shared<const order_type>(); }
+		}
+		name_index_ = std::make_shared<const name_index_type>();
+	}
+
+	std::shared_ptr<const room_table> room_table::with_room(const room_data& room) const {
+		auto table = std::make_shared<room_table>(*this);
+		auto& rooms = table->rooms_;
+		const auto data = make_room_summary(room);
+		const auto it = rooms.lower_bound(data.room_id, {}, &room_summary::room_id);
+		if (it != rooms.end() && it->room_id == data.room_id) {
+			const auto previous_data = *it;
+			rooms.replace(it, data);
+			const auto is_partition_changed = get_partition_index(previous_data.setting_flags) !=
+				get_partition_index(data.setting_flags);
+			for (auto i = 0u; i < order_sort_kinds.size(); ++i) {
+				const auto order_kind = static_cast<room_table::order_kind>(i);
+				if (!is_partition_changed && has_same_sort_key(order_kind, previous_data, data)) { continue; }
+
+				table->erase_from_order(order_kind, *this, data.room_id);
+				table->insert_into_order(order_kind, data.room_id);
+			}
+
+			if (previous_data.host_player_full_name.name != data.host_player_full_name.name) {
+				auto name_index = std::make_shared<name_index_type>(*name_index_);
+				table->erase_from_name_index(*name_index, previous_data);
+				table->insert_into_name_index(*name_index, data);
+				table->name_index_ = std::move(name_index);
+			}
+		}
+		else {
+			rooms.insert(it, data);
+			for (auto i = 0u; i < order_sort_kinds.size(); ++i) {
+				table->insert_into_order(static_cast<order_kind>(i), data.room_id);
+			}
+
+			auto name_index = std::make_shared<name_index_type>(*name_index_);
+			table->insert_into_name_index(*name_index, data);
+			table->name_index_ = std::move(name_index);
+		}
+
+		return table;
+	}
+
+	std::shared_ptr<const room_table> room_table::without_room(const room_id_t room_id) const {
+		auto table = std::make_shared<room_table>(*this);
+		auto& rooms = table->rooms_;
+		if (const auto it = rooms.lower_bound(room_id, {}, &room_summary::room_id); it != rooms.end() && it->room_id ==
+			room_id) {
+			rooms.erase(it);
+			for (auto i = 0u; i < order_sort_kinds.size(); ++i) {
+				table->erase_from_order(static_cast<order_kind>(i), *this, room_id);
+			}
+
+			auto name_index = std::make_shared<name_index_type>(*name_index_);
+			table->erase_from_name_index(*name_index, get(room_id));
+			table->name_index_ = std::move(name_index);
+		}
+
+		return table;
+	}
+
+	const room_table::room_container_type& room_table::rooms() const { return rooms_; }
+
+	const room_summary& room_table::get(const room_id_t room_id) const {
+		const auto it = rooms_.lower_bound(room_id, {}, &room_summary::room_id);
+		assert(it != rooms_.end() && it->room_id == room_id);
+		return *it;
+	}
+
+	const room_table::order_type& room_table::get_order(const room_setting_flag setting_flags,
+		const room_data_sort_kind sort_kind) const {
+		return *orders_[get_partition_index(setting_flags)][static_cast<size_t>(get_order_kind(sort_kind))];
+	}
+
+	std::optional<std::vector<room_id_t>> room_table::find_name_candidates(const player_name_t& search_name) const {
+		const auto trigrams = make_name_trigrams(search_name);
+		if (trigrams.empty()) { return std::nullopt; }
+
+		std::vector<name_posting_list_type> posting_lists;
+		posting_lists.reserve(trigrams.size());
+		for (auto&& trigram : trigrams) {
+			const auto posting_list = get_name_posting_list(trigram);
+			if (posting_list.empty()) { return std::vector<room_id_t>{}; }
+			posting_lists.push_back(posting_list);
+		}
+
+		// Intersect from the shortest list so the intermediate result never grows.
+		std::ranges::sort(posting_lists, {}, [](const name_posting_list_type& list) { return list.size(); });
+		std::vector<room_id_t> candidates;
+		candidates.reserve(posting_lists.front().size());
+		std::ranges::transform(posting_lists.front(), std::back_inserter(candidates), &name_index_entry::room_id);
+		for (auto i = 1u; i < posting_lists.size() && !candidates.empty(); ++i) {
+			const auto intersection_end = std::ranges::set_intersection(candidates,
+				posting_lists[i] | std::views::transform(&name_index_entry::room_id), candidates.begin()).out;
+			candidates.erase(intersection_end, candidates.end());
+		}
+
+		return candidates;
+	}
+
+	room_table::name_posting_list_type room_table::get_name_posting_list(const player_name_t& trigram_name) const {
+		if (trigram_name.size() != 3) { throw std::invalid_argument("A trigram must be three bytes."); }
+		return get_name_posting_list(make_name_trigram(trigram_name, 0));
+	}
+
+	size_t room_table::size() const { return rooms_.size(); }
+
+	size_t room_table::get_partition_index(const room_setting_flag setting_flags) {
+		return static_cast<size_t>(setting_flags & (room_setting_flag::public_room | room_setting_flag::open_room));
+	}
+
+	room_table::order_kind room_table::get_order_kind(const room_data_sort_kind sort_kind) {
+		switch (sort_kind) {
+			case room_data_sort_kind::name_ascending:
+			case room_data_sort_kind::name_descending:
+				return order_kind::name;
+			case room_data_sort_kind::create_datetime_ascending:
+			case room_data_sort_kind::create_datetime_descending:
+				return order_kind::create_datetime;
+			default:
+				throw std::out_of_range("Invalid room_data_sort_kind.");
+		}
+	}
+
+	room_table::name_trigram_type room_table::make_name_trigram(const player_name_t& name, const size_t index) {
+		return static_cast<name_trigram_type>(name[index]) << 16 |
+			static_cast<name_trigram_type>(name[index + 1]) << 8 | static_cast<name_trigram_type>(name[index + 2]);
+	}
+
+	std::vector<room_table::name_trigram_type> room_table::make_name_trigrams(const player_name_t& name) {
+		const auto name_size = name.size();
+		std::vector<name_trigram_type> trigrams;
+		if (name_size < 3) { return trigrams; }
+
+		trigrams.reserve(name_size - 2);
+		for (auto i = 0u; i + 2 < name_size; ++i) { trigrams.push_back(make_name_trigram(name, i)); }
+
+		std::ranges::sort(trigrams);
+		const auto [unique_end, end] = std::ranges::unique(trigrams);
+		trigrams.erase(unique_end, end);
+		return trigrams;
+	}
+
+	room_table::name_posting_list_type room_table::get_name_posting_list(const name_trigram_type trigram) const {
+		const auto begin = name_index_->lower_bound(trigram, {}, &name_index_entry::trigram);
+		auto end = begin;
+		size_t size = 0;
+		for (; end != name_index_->end() && end->trigram == trigram; ++end) { ++size; }
+		return {begin, end, size};
+	}
+
+	void room_table::insert_into_name_index(name_index_type& name_index, const room_summary& data) {
+		for (auto&& trigram : make_name_trigrams(data.host_player_full_name.name)) {
+			const name_index_entry entry{trigram, data.room_id};
+			name_index.insert(name_index.lower_bound(entry), entry);
+		}
+	}
+
+	void room_table::erase_from_name_index(name_index_type& name_index, const room_summary& data) {
+		for (auto&& trigram : make_name_trigrams(data.host_player_full_name.name)) {
+			const name_index_entry entry{trigram, data.room_id};
+			const auto it = name_index.lower_bound(entry);
+			assert(it != name_index.end() && *it == entry);
+			name_index.erase(it);
+		}
+	}
+
+	bool room_table::has_same_sort_key(const order_kind order_kind, const room_summary& left,
+		const room_summary& right) {
+		switch (order_kind) {
+			case order_kind::name:
+				return left.host_player_full_name == right.host_player_full_name;
+			case order_kind::create_datetime:
+				return left.create_datetime == right.create_datetime;
+		}
+		return false;
+	}
+
+	void room_table::insert_into_order(const order_kind order_kind, const room_id_t room_id) {
+		const auto sort_kind = order_sort_kinds[static_cast<size_t>(order_kind)];
+		const auto& data = get(room_id);
+		auto& order = orders_[get_partition_index(data.setting_flags)][static_cast<size_t>(order_kind)];
+		auto new_order = std::make_shared<order_type>(*order);
+		const auto it = visit_room_data_order(sort_kind, [&](const auto room_order) {
+			return new_order->lower_bound(data, room_order,
+				[this](const room_id_t id) -> const room_summary& { return get(id); });
+		});
+		new_order->insert(it, room_id);
+		order = std::move(new_order);
+	}
+
+	void room_table::erase_from_order(const order_kind order_kind, const room_table& previous_table,
+		const room_id_t room_id) {
+		const auto sort_kind = order_sort_kinds[static_cast<size_t>(order_kind)];
+		const auto& data = previous_table.get(room_id);
+		auto& order = orders_[get_partition_index(data.setting_flags)][static_cast<size_t>(order_kind)];
+		auto new_order = std::make_shared<order_type>(*order);
+		const auto it = visit_room_data_order(sort_kind, [&](const auto room_order) {
+			return new_order->lower_bound(data, room_order,
+				[&previous_table](const room_id_t id) -> const room_summary& { return previous_table.get(id); });
+		});
+		assert(it != new_order->end() && *it == room_id);
+		new_order->erase(it);
+		order = std::move(new_order);
+	}
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+#include "data/chunked_vector.hpp"
+
+#include "room_constants.hpp"
+#include "room_data.hpp"
+
+namespace pgl {
+	/**
+	 * An immutable table of room data published by room_data_container.
+	 *
+	 * A table is never modified after it is published. Writers make a new table from the current one and publish it,
+	 * so readers can iterate a table they pinned without any lock even while rooms are updated.
+	 * Rooms and sorted orders are kept in chunked_vector, so a new table shares all chunks with the current one except the chunk of the changed room.
+	 * The table also keeps room IDs sorted for each room_data_sort_kind, so readers can walk rooms in the requested order
+	 * without sorting them. Sorted orders are split into partitions by room_setting_flag, so readers visit only rooms
+	 * whose flags match the search and get the number of them without visiting rooms.
+	 * Sorted orders are shared with the previous table unless a sort key or setting flags of a room are changed.
+	 * Host player names are indexed by trigrams so substring search visits only rooms which can contain the search name.
+	 * The index is a chunked_vector too, so adding, removing or renaming a room copies only chunks of the trigrams of the names.
+	 * Rooms are kept as room_summary, so scanning them does not load passwords, endpoints and external IDs which only joining players need.
+	 */
+	class room_table final {
+	public:
+		using room_container_type = chunked_vector<room_summary>;
+		using order_type = chunked_vector<room_id_t>;
+		// A trigram is three consecutive bytes of UTF-8 name packed into an integer.
+		using name_trigram_type = uint32_t;
+
+		struct name_index_entry final {
+			name_trigram_type trigram;
+			room_id_t room_id;
+
+			auto operator<=>(const name_index_entry&) const = default;
+		};
+
+		// Entries are sorted by trigram and then by room ID, so entries of each trigram are a posting list sorted by room ID.
+		using name_index_type = chunked_vector<name_index_entry>;
+		using name_posting_list_type = std::ranges::subrange<name_index_type::const_iterator,
+			name_index_type::const_iterator, std::ranges::subrange_kind::sized>;
+
+		// Setting flags of each partition.
+		static constexpr std::array partition_setting_flags = {
+			room_setting_flag::none,
+			room_setting_flag::public_room,
+			room_setting_flag::open_room,
+			room_setting_flag::public_room | room_setting_flag::open_room
+		};
+
+		room_table();
+
+		/**
+		 * Make a new table in which the room is added or replaced.
+		 *
+		 * @param room A room data to add or replace.
+		 * @return A new table.
+		 */
+		[[nodiscard]] std::shared_ptr<const room_table> with_room(const room_data& room) const;
+
+		/**
+		 * Make a new table in which the room is removed.
+		 *
+		 * @param room_id An ID of the room to remove.
+		 * @return A new table. The table has same rooms as this table if the room does not exist.
+		 */
+		[[nodiscard]] std::shared_ptr<const room_table> without_room(room_id_t room_id) const;
+
+		/**
+		 * Get all rooms in this table.
+		 *
+		 * @return A list of room summaries sorted by room ID.
+		 */
+		[[nodiscard]] const room_container_type& rooms() const;
+
+		/**
+		 * Get a room in this table.
+		 *
+		 * @param room_id An ID of the room. The room must exist in this table.
+		 * @return A room summary.
+		 */
+		[[nodiscard]] const room_summary& get(room_id_t room_id) const;
+
+		/**
+		 * Get room IDs in a partition sorted by the sort key of sort_kind in ascending order. The order of descending sort kind is the reverse of the order.
+		 *
+		 * @param setting_flags Setting flags of the partition.
+		 * @param sort_kind A kind of sort.
+		 * @return A list of IDs of rooms whose setting flags are setting_flags, sorted by room_data_order of the ascending sort kind.
+		 * @throw std::out_of_range sort_kind is invalid.
+		 */
+		[[nodiscard]] const order_type& get_order(room_setting_flag setting_flags, room_data_sort_kind sort_kind) const;
+
+		/**
+		 * Find rooms whose host player name can contain search_name by the trigram index.
+		 *
+		 * @param search_name A name to search.
+		 * @return A list of candidate room IDs sorted by room ID. Rooms which are not in the list never contain search_name. std::nullopt if search_name is too short to use the index.
+		 */
+		[[nodiscard]] std::optional<std::vector<room_id_t>> find_name_candidates(const player_name_t& search_name) const;
+
+		/**
+		 * Get entries of the trigram index for a trigram.
+		 *
+		 * @param trigram_name A name of three bytes.
+		 * @return Entries whose trigram is trigram_name, sorted by room ID.
+		 * @throw std::invalid_argument trigram_name is not three bytes.
+		 */
+		[[nodiscard]] name_posting_list_type get_name_posting_list(const player_name_t& trigram_name) const;
+
+		/**
+		 * Get the number of rooms in this table.
+		 *
+		 * @return The number of rooms.
+		 */
+		[[nodiscard]] size_t size() const;
+
+	private:
+		enum class order_kind : uint8_t {
+			name,
+			create_datetime
+		};
+
+		static constexpr std::array order_sort_kinds = {
+			room_data_sort_kind::name_ascending,
+			room_data_sort_kind::create_datetime_ascending
+		};
+
+		room_container_type rooms_;
+		std::array<std::array<std::shared_ptr<const order_type>, order_sort_kinds.size()>, partition_setting_flags.size()>
+		orders_;
+		// Shared with the previous table unless a room is added or removed or a host player name is changed. Even then, only chunks which have trigrams of the names are copied.
+		std::shared_ptr<const name_index_type> name_index_;
+
+		[[nodiscard]] static size_t get_partition_index(room_setting_flag setting_flags);
+
+		[[nodiscard]] static order_kind get_order_kind(room_data_sort_kind sort_kind);
+
+		[[nodiscard]] static name_trigram_type make_name_trigram(const player_name_t& name, size_t index);
+
+		[[nodiscard]] static std::vector<name_trigram_type> make_name_trigrams(const player_name_t& name);
+
+		[[nodiscard]] name_posting_list_type get_name_posting_list(name_trigram_type trigram) const;
+
+		static void insert_into_name_index(name_index_type& name_index, const room_summary& data);
+
+		static void erase_from_name_index(name_index_type& name_index, const room_summary& data);
+
+		[[nodiscard]] static bool has_same_sort_key(order_kind order_kind, const room_summary& left,
+			const room_summary& right);
+
+		// The room must exist in this table.
+		void insert_into_order(order_kind order_kind, room_id_t room_id);
+
+		// The room must exist in previous_table. The order is selected by setting flags of the room in previous_table.
+		void erase_from_order(order_kind order_kind, const room_table& previous_table, room_id_t room_id);
+	};
+}
@@ -0,0 +1,40 @@
+#include <mutex>
+
+#include "list_room_reply_cache.hpp"
+
+namespace pgl {
+	list_room_reply_cache::list_room_reply_cache(const size_t capacity) : capacity_(capacity) {}
+
+	bool list_room_reply_cache::is_enabled() const { return capacity_ > 0; }
+
+	list_room_reply_cache::packed_reply_type list_room_reply_cache::try_get(const uint64_t version,
+		const list_room_reply_cache_key& key) {
+		packed_reply_type packed_reply;
+		{
+			std::shared_lock lock(mutex_);
+			if (version_ == version) {
+				if (const auto it = packed_replies_.find(key); it != packed_replies_.end()) { packed_reply = it->second; }
+			}
+		}
+
+		(packed_reply ? hit_count_ : miss_count_).fetch_add(1, std::memory_order_relaxed);
+		return packed_reply;
+	}
+
+	void list_room_reply_cache::add(const uint64_t version, const list_room_reply_cache_key& key,
+		packed_reply_type packed_reply) {
+		std::lock_guard lock(mutex_);
+		if (version < version_) { return; }
+		if (version > version_) {
+			packed_replies_.clear();
+			version_ = version;
+		}
+
+		if (packed_replies_.size() >= capacity_) { return; }
+		packed_replies_.emplace(key, std::move(packed_reply));
+	}
+
+	uint64_t list_room_reply_cache::hit_count() const { return hit_count_.load(std::memory_order_relaxed); }
+
+	uint64_t list_room_reply_cache::miss_count() const { return miss_count_.load(std::memory_order_relaxed); }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "room/room_data.hpp"
+
+namespace pgl {
+	// Search conditions of list_room request which is cacheable. Requests with search name are not cached.
+	struct list_room_reply_cache_key final {
+		room_data_sort_kind sort_kind;
+		room_search_target_flag search_target_flags;
+		uint16_t start_index;
+		uint16_t count;
+
+		bool operator==(const list_room_reply_cache_key& other) const = default;
+	};
+}
+
+template <>
+struct std::hash<pgl::list_room_reply_cache_key> {
+	size_t operator()(const pgl::list_room_reply_cache_key& key) const noexcept {
+		size_t seed = 0;
+		boost::hash_combine(seed, key.sort_kind);
+		boost::hash_combine(seed, key.search_target_flags);
+		boost::hash_combine(seed, key.start_index);
+		boost::hash_combine(seed, key.count);
+		return seed;
+	}
+};
+
+namespace pgl {
+	/**
+	 * A thread safe cache of packed list_room replies.
+	 *
+	 * Replies are cached with the version of room_data_container when the search started. All replies are dropped when a reply of newer version is added, so a cached reply is never returned for other version.
+	 */
+	class list_room_reply_cache final : boost::noncopyable {
+	public:
+		using packed_reply_type = std::shared_ptr<const std::vector<uint8_t>>;
+
+		/**
+		 * Create a list_room reply cache.
+		 *
+		 * @param capacity The maximum number of cached replies. 0 disables the cache.
+		 */
+		explicit list_room_reply_cache(size_t capacity);
+
+		/**
+		 * Check if the cache is enabled.
+		 *
+		 * @return Whether the capacity is not 0.
+		 */
+		[[nodiscard]] bool is_enabled() const;
+
+		/**
+		 * Get a cached reply and count up a hit or a miss.
+		 *
+		 * @param version The current version of room_data_container.
+		 * @param key Search conditions of the request.
+		 * @return Packed reply headers and bodies. nullptr if no reply is cached for the version and the key.
+		 */
+		[[nodiscard]] packed_reply_type try_get(uint64_t version, const list_room_reply_cache_key& key);
+
+		/**
+		 * Add a reply. The reply is ignored if the version is older than the cached replies or the cache is full.
+		 *
+		 * @param version The version of room_data_container got before the search of the reply started.
+		 * @param key Search conditions of the request.
+		 * @param packed_reply Packed reply headers and bodies.
+		 */
+		void add(uint64_t version, const list_room_reply_cache_key& key, packed_reply_type packed_reply);
+
+		/**
+		 * Get the number of requests replied from the cache.
+		 *
+		 * @return The number of cache hits.
+		 */
+		[[nodiscard]] uint64_t hit_count() const;
+
+		/**
+		 * Get the number of requests which are not found in the cache.
+		 *
+		 * @return The number of cache misses.
+		 */
+		[[nodiscard]] uint64_t miss_count() const;
+
+	private:
+		const size_t capacity_;
+		uint64_t version_ = 0;
+		std::unordered_map<list_room_reply_cache_key, packed_reply_type> packed_replies_;
+		mutable std::shared_mutex mutex_;
+		std::atomic<uint64_t> hit_count_{0};
+		std::atomic<uint64_t> miss_count_{0};
+	};
+}
@@ -1,45 +1,70 @@
 #include <boost/thread.hpp>
+#include <algorithm>
 #include <exception>
 #include <mutex>
 #include <memory>
+#include <system_error>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include "server.hpp"
 
 #include "server_tls_reload_signal_handler.hpp"
 #include "server_thread.hpp"
+#include "tls_handshake_pool.hpp"
+#include "async/io_context_concurrency.hpp"
 #include "logger/log.hpp"
+#include "network/transport_layer.hpp"
 
 using namespace boost;
 
 namespace pgl {
+	namespace {
+		// Pin the calling thread to a CPU. Only a warning is logged on failure because the server works without affinity.
+		void set_current_thread_cpu_affinity([[maybe_unused]] const unsigned thread_index) {
+#ifdef __linux__
+			const auto cpu = thread_index % std::max(std::thread::hardware_concurrency(), 1u);
+			cpu_set_t cpu_set;
+			CPU_ZERO(&cpu_set);
+			CPU_SET(cpu, &cpu_set);
+			if (const auto error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); error != 0) {
+				log(log_level::warning, "Failed to pin thread to CPU ", cpu, ": ",
+					std::system_category().message(error));
+			}
+#endif
+		}
+	}
+
+	server::server(std::unique_ptr<server_setting>&& setting): server_setting_(std::move(setting)) {
+		create_io_contexts();
 
-	server::server(std::unique_ptr<server_setting>&& setting): acceptor_(io_service_),
-		server_setting_(std::move(setting)) {
 		// Setup server data
-		server_data_ = std::make_unique<server_data>();
+		server_data_ = std::make_unique<server_data>(server_setting_->common.room_shard_count,
+			server_setting_->common.list_room_reply_cache_size,
+			server_setting_->common.enable_slot_map_room_storage
+				? room_storage_kind::slot_map
+				: room_storage_kind::hash_map);
 
 		reload_tls_context();
 
-		// Setup acceptor
-		const auto tcp = get_tcp(server_setting_->common.ip_version);
-		acceptor_.open(tcp);
-		try { acceptor_.bind(asio::ip::tcp::endpoint(tcp, server_setting_->common.port)); }
-		catch (system::system_error&) {
-			log(log_level::fatal, "Failed to start listening ", server_setting_->common.port, " port.");
-			throw;
-		}
-		acceptor_.listen();
+		open_listeners();
 	}
 
 	void server::run() {
 		// prevent to stop server when all request are processed
-		auto work = asio::make_work_guard(io_service_);
+		std::vector<asio::executor_work_guard<asio::io_context::executor_type>> work_guards;
+		work_guards.reserve(io_contexts_.size());
+		for (auto&& io_context : io_contexts_) { work_guards.push_back(asio::make_work_guard(*io_context)); }
 
 #ifndef _WIN32
 		std::unique_ptr<server_tls_reload_signal_handler> tls_reload_signal_handler;
 		if (server_setting_->tls.mode == server_tls_mode::tls && server_setting_->tls.reload_on_sighup) {
 			tls_reload_signal_handler = std::make_unique<server_tls_reload_signal_handler>(
-				io_service_, [this] {
+				*io_contexts_.front(), [this] {
 					log(log_level::info, "Received SIGHUP. Reload TLS certificate.");
 					try_reload_tls_context();
 				});
@@ -52,25 +77,51 @@ namespace pgl {
 		}
 #endif
 
+		auto enable_cpu_affinity = server_setting_->common.enable_cpu_affinity;
+#ifndef __linux__
+		if (enable_cpu_affinity) {
+			log(log_level::warning, "CPU affinity is not supported on this platform.");
+			enable_cpu_affinity = false;
+		}
+		if (server_setting_->tls.enable_ktls) {
+			log(log_level::warning, "kTLS is not supported on this platform. TLS is processed by OpenSSL.");
+		}
+#endif
+
+		// Sessions need no strand if their I/O context is run by only one thread.
+		const auto is_io_context_run_by_one_thread = io_contexts_.size() == server_setting_->common.thread;
+
+		// Declared before the thread group so that handshakes are abandoned only after session threads are joined.
+		std::unique_ptr<tls_handshake_pool> handshake_pool;
+		if (server_setting_->tls.mode == server_tls_mode::tls && server_setting_->tls.handshake_thread > 0) {
+			handshake_pool = std::make_unique<tls_handshake_pool>(server_setting_->tls.handshake_thread,
+				server_setting_->tls.max_pending_handshake);
+			log(log_level::info, "Start ", server_setting_->tls.handshake_thread, " TLS handshake threads.");
+		}
+
 		log(log_level::info, "Start ", server_setting_->common.thread, " threads.");
 
 		std::mutex exception_mutex;
 		std::exception_ptr first_exception;
 		thread_group thread_group;
 		for (auto i = 0u; i < server_setting_->common.thread; ++i) {
-			thread_group.create_thread([&]() {
+			thread_group.create_thread([&, i]() {
 				try {
-					server_thread server_thread(acceptor_, acceptor_mutex_, tls_context_, *server_data_,
+					if (enable_cpu_affinity) { set_current_thread_cpu_affinity(i); }
+					auto& io_context = *io_contexts_[i % io_contexts_.size()];
+					auto& listener = *listeners_[i % listeners_.size()];
+					server_thread server_thread(listener.acceptor, listener.acceptor_mutex,
+						is_io_context_run_by_one_thread, tls_context_, handshake_pool.get(), *server_data_,
 						*server_setting_);
 					server_thread.start();
-					io_service_.run();
+					io_context.run();
 				}
 				catch (...) {
 					{
 						std::lock_guard lock(exception_mutex);
 						if (!first_exception) { first_exception = std::current_exception(); }
 					}
-					io_service_.stop();
+					for (auto&& io_context : io_contexts_) { io_context->stop(); }
 				}
 			});
 		}
@@ -79,6 +130,55 @@ namespace pgl {
 		if (first_exception) { std::rethrow_exception(first_exception); }
 	}
 
+	void server::create_io_contexts() {
+		auto io_context_count = 1u;
+		if (server_setting_->common.enable_io_context_per_thread) {
+			if (is_reuse_port_supported()) { io_context_count = server_setting_->common.thread; }
+			else {
+				log(log_level::warning,
+					"I/O context per thread needs SO_REUSEPORT which is not supported on this platform. All threads share one I/O context.");
+			}
+		}
+
+		const auto concurrency_hint = get_io_context_concurrency_hint(
+			io_context_count == server_setting_->common.thread);
+		io_contexts_.reserve(io_context_count);
+		for (auto i = 0u; i < io_context_count; ++i) {
+			io_contexts_.push_back(std::make_unique<asio::io_context>(concurrency_hint));
+		}
+
+		if (io_context_count > 1) { log(log_level::info, "Each thread runs its own I/O context."); }
+	}
+
+	void server::open_listeners() {
+		// Each I/O context needs its own listener.
+		auto use_reuse_port = server_setting_->common.enable_reuse_port || io_contexts_.size() > 1;
+		if (use_reuse_port && !is_reuse_port_supported()) {
+			log(log_level::warning, "SO_REUSEPORT is not supported on this platform. All threads share one acceptor.");
+			use_reuse_port = false;
+		}
+
+		const auto listener_count = use_reuse_port ? server_setting_->common.thread : 1u;
+		const auto tcp = get_tcp(server_setting_->common.ip_version);
+		listeners_.reserve(listener_count);
+		for (auto i = 0u; i < listener_count; ++i) {
+			auto listener = std::make_unique<server::listener>(*io_contexts_[i % io_contexts_.size()]);
+			listener->acceptor.open(tcp);
+			try {
+				if (use_reuse_port) { set_reuse_port(listener->acceptor); }
+				listener->acceptor.bind(asio::ip::tcp::endpoint(tcp, server_setting_->common.port));
+			}
+			catch (system::system_error&) {
+				log(log_level::fatal, "Failed to start listening ", server_setting_->common.port, " port.");
+				throw;
+			}
+			listener->acceptor.listen();
+			listeners_.push_back(std::move(listener));
+		}
+
+		if (use_reuse_port) { log(log_level::info, "Each thread listens with its own SO_REUSEPORT socket."); }
+	}
+
 	void server::reload_tls_context() {
 		tls_context_.reload(server_setting_->tls);
 	}
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <boost/asio.hpp>
 #include <boost/asio/ssl.hpp>
@@ -17,13 +18,24 @@ namespace pgl {
 		explicit server(std::unique_ptr<server_setting>&& setting);
 		void run();
 	private:
-		boost::asio::io_context io_service_;
+		// A listening socket shared by sessions of server threads. async_accept is initiated under the mutex.
+		struct listener final : boost::noncopyable {
+			boost::asio::ip::tcp::acceptor acceptor;
+			std::mutex acceptor_mutex;
+
+			explicit listener(boost::asio::io_context& io_context) : acceptor(io_context) {}
+		};
+
+		// One I/O context run by all threads, or one per thread which runs only it.
+		std::vector<std::unique_ptr<boost::asio::io_context>> io_contexts_;
 		server_tls_context tls_context_;
-		boost::asio::ip::tcp::acceptor acceptor_;
-		std::mutex acceptor_mutex_;
+		// One listener for all threads, or one per thread with SO_REUSEPORT.
+		std::vector<std::unique_ptr<listener>> listeners_;
 		std::unique_ptr<server_data> server_data_;
 		std::unique_ptr<server_setting> server_setting_;
 
+		void create_io_contexts();
+		void open_listeners();
 		void reload_tls_context();
 		void try_reload_tls_context() noexcept;
 	};
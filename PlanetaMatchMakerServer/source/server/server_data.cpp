@@ -1,6 +1,11 @@
 #include "server_data.hpp"
 
 namespace pgl {
+	server_data::server_data(const size_t room_shard_count, const size_t list_room_reply_cache_size,
+		const room_storage_kind room_storage_kind):
+		room_data_container_(room_shard_count, room_storage_kind),
+		list_room_reply_cache_(list_room_reply_cache_size) {}
+
 	const server_data::room_data_container_type& server_data::get_room_data_container() const {
 		return room_data_container_;
 	}
@@ -12,6 +17,8 @@ namespace pgl {
 
 	player_name_container& server_data::get_player_name_container() { return player_name_container_; }
 
+	list_room_reply_cache& server_data::get_list_room_reply_cache() { return list_room_reply_cache_; }
+
 	session_number_t server_data::issue_session_number() {
 		return next_session_number_.fetch_add(1, std::memory_order_relaxed);
 	}
@@ -5,12 +5,23 @@
 #include "room/room_data_container.hpp"
 #include "client/player_name_container.hpp"
 #include "session/session_constants.hpp"
+#include "list_room_reply_cache.hpp"
 
 namespace pgl {
 	class server_data final {
 	public:
 		using room_data_container_type = room_data_container;
 
+		/**
+		 * Create server data.
+		 *
+		 * @param room_shard_count The number of shards of room data container.
+		 * @param list_room_reply_cache_size The maximum number of cached list_room replies. 0 disables the cache.
+		 * @param room_storage_kind A kind of storage of rooms in each shard.
+		 */
+		explicit server_data(size_t room_shard_count = 1, size_t list_room_reply_cache_size = 64,
+			room_storage_kind room_storage_kind = room_storage_kind::hash_map);
+
 		[[nodiscard]] const room_data_container_type& get_room_data_container() const;
 
 		[[nodiscard]] const player_name_container& get_player_name_container() const;
@@ -19,10 +30,13 @@ namespace pgl {
 
 		[[nodiscard]] player_name_container& get_player_name_container();
 
+		[[nodiscard]] list_room_reply_cache& get_list_room_reply_cache();
+
 		[[nodiscard]] session_number_t issue_session_number();
 	private:
 		std::atomic<session_number_t> next_session_number_{1};
 		room_data_container_type room_data_container_;
 		player_name_container player_name_container_;
+		list_room_reply_cache list_room_reply_cache_;
 	};
 }
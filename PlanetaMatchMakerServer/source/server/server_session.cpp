@@ -1,4 +1,3 @@
-#include <boost/asio/spawn.hpp>
 #include <exception>
 #include <mutex>
 #include <utility>
@@ -13,6 +12,8 @@
 #include "server_errors.hpp"
 #include "utilities/checked_static_cast.hpp"
 #include "server/server_setting.hpp"
+#include "server/server_session_pool.hpp"
+#include "server/tls_handshake_pool.hpp"
 
 #include "server_session.hpp"
 
@@ -34,19 +35,23 @@ namespace pgl {
 	}
 
 	server_session::server_session(asio::ip::tcp::acceptor& acceptor, std::mutex& acceptor_mutex,
-		server_tls_context& tls_context, server_data& server_data, const server_setting& server_setting,
-		std::shared_ptr<const message_handler_invoker> message_handler_invoker):
+		asio::any_io_executor executor, std::shared_ptr<timer_wheel> deadline_wheel, server_tls_context& tls_context,
+		tls_handshake_pool* tls_handshake_pool, server_data& server_data, const server_setting& server_setting,
+		std::shared_ptr<const message_handler_invoker> message_handler_invoker,
+		std::weak_ptr<server_session_pool> session_pool):
 		acceptor_(acceptor),
 		acceptor_mutex_(acceptor_mutex),
 		tls_context_(tls_context),
+		tls_handshake_pool_(tls_handshake_pool),
 		server_data_(server_data),
 		server_setting_(server_setting),
 		message_handler_invoker_(std::move(message_handler_invoker)),
-		strand_(asio::make_strand(acceptor.get_executor())),
-		connection_(strand_, tls_context_) { }
+		session_pool_(std::move(session_pool)),
+		executor_(std::move(executor)),
+		connection_(executor_, tls_context_, std::move(deadline_wheel)) { }
 
 	void server_session::start() {
-		asio::dispatch(strand_, [shared_this = shared_from_this()] {
+		asio::dispatch(executor_, [shared_this = shared_from_this()] {
 			shared_this->start_impl();
 		});
 	}
@@ -62,10 +67,10 @@ namespace pgl {
 		const auto shared_this = shared_from_this();
 		log(log_level::debug, "Start to accept.");
 		{
-			// Serialize accept initiation on the shared acceptor, then bind completion to this session strand.
+			// Serialize accept initiation on the shared acceptor, then bind completion to this session executor.
 			std::lock_guard lock(acceptor_mutex_);
 			acceptor_.async_accept(connection_.socket(),
-				asio::bind_executor(strand_, [shared_this](const system::error_code& accept_error) {
+				asio::bind_executor(executor_, [shared_this](const system::error_code& accept_error) {
 					shared_this->handle_accepted_connection(accept_error);
 				}));
 		}
@@ -74,91 +79,154 @@ namespace pgl {
 	void server_session::handle_accepted_connection(const system::error_code& accept_error) {
 		if (is_stopping_.load(std::memory_order_acquire)) { return; }
 
-		static_cast<void>(spawn(strand_, [shared_this=shared_from_this(), accept_error](asio::yield_context yield) {
+		// Let the pool add a waiting session before processing the connection.
+		if (!accept_error) {
+			is_connected_ = true;
+			if (const auto session_pool = session_pool_.lock()) { session_pool->on_connection_accepted(); }
+		}
+
+		// Rethrow an exception which escapes the session to the thread running the I/O context.
+		asio::co_spawn(executor_, communicate(shared_from_this(), accept_error), [](const std::exception_ptr& e) {
+			if (e) { std::rethrow_exception(e); }
+		});
+	}
+
+	asio::awaitable<void> server_session::handshake(const std::shared_ptr<server_session> shared_this) {
+		const auto time_out = chrono::seconds(shared_this->server_setting_.common.time_out_seconds);
+		if (auto* const pool = shared_this->tls_handshake_pool_) {
+			shared_this->is_handshaking_on_pool_ = true;
+			bool is_accepted;
 			try {
-				try {
-					if (shared_this->is_stopping_.load(std::memory_order_acquire)) { return; }
-					if (accept_error) {
-						const auto extra_message = generate_string("Acception failed: ", accept_error.message());
-						throw server_session_error(extra_message);
-					}
-
-					shared_this->session_data_->set_remote_endpoint(
-						endpoint::make_from_boost_endpoint(
-							shared_this->connection_.remote_endpoint()));
-					shared_this->session_data_->set_session_number(shared_this->server_data_.issue_session_number());
-				}
-				catch (system::system_error& e) {
-					const auto extra_message = generate_string("Acception failed: ", e, " @",
-						shared_this->connection_.remote_endpoint());
-					throw server_session_error(extra_message);
-				}
+				is_accepted = co_await pool->async_handshake(shared_this->connection_, time_out,
+					shared_this->tls_handshake_canceller_);
+			}
+			catch (...) {
+				shared_this->finish_handshake_on_pool();
+				throw;
+			}
+			shared_this->finish_handshake_on_pool();
+			// The session data is released if the session is stopped during the handshake.
+			if (shared_this->is_stopping_.load(std::memory_order_acquire)) { co_return; }
+			if (!is_accepted) {
+				const auto extra_message = generate_string("TLS handshake queue is full (refused handshakes: ",
+					pool->refused_handshake_count(), ").");
+				throw server_session_error(extra_message);
+			}
+			log_with_session_data_endpoint(log_level::debug, *shared_this->session_data_,
+				"Pending TLS handshakes: ", pool->pending_handshake_count(), " (peak: ",
+				pool->peak_pending_handshake_count(), ").");
+		}
+		else {
+			co_await execute_socket_timed_async_operation(shared_this->connection_, time_out,
+				shared_this->connection_.async_handshake());
+		}
 
-				log_with_session_data_endpoint(log_level::info, *shared_this->session_data_,
-					"Accepted new connection. Start to receive message.");
-
-				if (shared_this->server_setting_.tls.mode == server_tls_mode::tls) {
-					execute_socket_timed_async_operation(shared_this->connection_,
-						chrono::seconds(shared_this->server_setting_.common.time_out_seconds),
-						[shared_this, &yield]() { shared_this->connection_.async_handshake(yield); });
-					log_with_session_data_endpoint(log_level::info, *shared_this->session_data_,
-						"TLS handshake completed.");
-				}
+		log_with_session_data_endpoint(log_level::info, *shared_this->session_data_,
+			"TLS handshake completed (session resumed: ", shared_this->connection_.is_session_resumed(),
+			", resumed handshakes: ", shared_this->tls_context_.resumed_handshake_count(), "/",
+			shared_this->tls_context_.handshake_count(), ").");
+		if (const auto* const ktls_stream = shared_this->connection_.get_ktls_stream()) {
+			log_with_session_data_endpoint(log_level::debug, *shared_this->session_data_, "kTLS offload (send: ",
+				ktls_stream->is_send_offloaded(), ", receive: ", ktls_stream->is_receive_offloaded(), ").");
+		}
+	}
+
+	void server_session::finish_handshake_on_pool() {
+		is_handshaking_on_pool_ = false;
+		if (!std::exchange(is_connection_close_deferred_, false)) { return; }
 
-				// Prepare data
-				const auto message_handler_param = std::make_shared<message_handle_parameter>(message_handle_parameter{
-					shared_this->connection_, shared_this->server_data_, yield,
-					chrono::seconds(shared_this->server_setting_.common.time_out_seconds),
-					*shared_this->session_data_,
-					shared_this->server_setting_
-				});
+		boost::system::error_code ignored_error;
+		connection_.close(ignored_error);
+	}
 
-				// Authenticate client
-				shared_this->message_handler_invoker_->handle_specific_message(message_type::authentication,
-					message_handler_param);
+	asio::awaitable<void> server_session::communicate(const std::shared_ptr<server_session> shared_this,
+		const system::error_code accept_error) {
+		try {
+			try {
+				if (shared_this->is_stopping_.load(std::memory_order_acquire)) { co_return; }
+				if (accept_error) {
+					const auto extra_message = generate_string("Acception failed: ", accept_error.message());
+					throw server_session_error(extra_message);
+				}
 
-				// Receive message
-				while (true) { shared_this->message_handler_invoker_->handle_message(message_handler_param); }
+				shared_this->session_data_->set_remote_endpoint(
+					endpoint::make_from_boost_endpoint(
+						shared_this->connection_.remote_endpoint()));
+				shared_this->session_data_->set_session_number(shared_this->server_data_.issue_session_number());
 			}
-			catch (const server_session_intended_disconnect_error& e) {
-				if (shared_this->is_stopping_.load(std::memory_order_acquire)) { return; }
-				log_with_session_data_endpoint(log_level::info, *shared_this->session_data_,
-					"Intended disconnect: ", e);
-				shared_this->restart();
+			catch (system::system_error& e) {
+				const auto extra_message = generate_string("Acception failed: ", e, " @",
+					shared_this->connection_.remote_endpoint());
+				throw server_session_error(extra_message);
 			}
-			catch (const server_session_error& e) {
-				if (shared_this->is_stopping_.load(std::memory_order_acquire)) { return; }
-				// output log as info for session error because it is caused by external factors like disconnection by client and network error.
+
+			log_with_session_data_endpoint(log_level::info, *shared_this->session_data_,
+				"Accepted new connection. Start to receive message.");
+			if (const auto session_pool = shared_this->session_pool_.lock()) {
+				const auto& counter = session_pool->counter();
 				log_with_session_data_endpoint(log_level::info, *shared_this->session_data_,
-					e, " Disconnect the connection.");
-				shared_this->restart();
+					"Connections in this thread: ", counter.connected_session_count(), " (peak: ",
+					counter.peak_connected_session_count(), ").");
 			}
-			catch (const system::system_error& e) {
-				if (shared_this->is_stopping_.load(std::memory_order_acquire)) { return; }
-				log_with_session_data_endpoint(log_level::error, *shared_this->session_data_,
-					"Unhandled error: ", e, " Disconnect the connection: ");
-				shared_this->restart();
-			}
-			catch (const std::exception& e) {
-				if (shared_this->is_stopping_.load(std::memory_order_acquire)) { return; }
-				log_with_session_data_endpoint(log_level::error, *shared_this->session_data_,
-					typeid(e), ": ", e.what(), " Disconnect the connection.");
-				shared_this->restart();
-			}
-			catch (...) {
-				if (shared_this->is_stopping_.load(std::memory_order_acquire)) { return; }
-				log_with_session_data_endpoint(log_level::fatal, *shared_this->session_data_,
-					"Unknown error. Stop the server.");
-				shared_this->stop();
-				throw;
+
+			if (shared_this->server_setting_.tls.mode == server_tls_mode::tls) {
+				co_await handshake(shared_this);
+				if (shared_this->is_stopping_.load(std::memory_order_acquire)) { co_return; }
 			}
-		}, asio::detached));
+
+			// Prepare data
+			const auto message_handler_param = std::make_shared<message_handle_parameter>(message_handle_parameter{
+				shared_this->connection_, shared_this->server_data_,
+				chrono::seconds(shared_this->server_setting_.common.time_out_seconds),
+				*shared_this->session_data_,
+				shared_this->server_setting_
+			});
+
+			// Authenticate client
+			co_await shared_this->message_handler_invoker_->handle_specific_message(message_type::authentication,
+				message_handler_param);
+
+			// Receive message
+			while (true) { co_await shared_this->message_handler_invoker_->handle_message(message_handler_param); }
+		}
+		catch (const server_session_intended_disconnect_error& e) {
+			if (shared_this->is_stopping_.load(std::memory_order_acquire)) { co_return; }
+			log_with_session_data_endpoint(log_level::info, *shared_this->session_data_,
+				"Intended disconnect: ", e);
+			shared_this->restart();
+		}
+		catch (const server_session_error& e) {
+			if (shared_this->is_stopping_.load(std::memory_order_acquire)) { co_return; }
+			// output log as info for session error because it is caused by external factors like disconnection by client and network error.
+			log_with_session_data_endpoint(log_level::info, *shared_this->session_data_,
+				e, " Disconnect the connection.");
+			shared_this->restart();
+		}
+		catch (const system::system_error& e) {
+			if (shared_this->is_stopping_.load(std::memory_order_acquire)) { co_return; }
+			log_with_session_data_endpoint(log_level::error, *shared_this->session_data_,
+				"Unhandled error: ", e, " Disconnect the connection: ");
+			shared_this->restart();
+		}
+		catch (const std::exception& e) {
+			if (shared_this->is_stopping_.load(std::memory_order_acquire)) { co_return; }
+			log_with_session_data_endpoint(log_level::error, *shared_this->session_data_,
+				typeid(e), ": ", e.what(), " Disconnect the connection.");
+			shared_this->restart();
+		}
+		catch (...) {
+			if (shared_this->is_stopping_.load(std::memory_order_acquire)) { co_return; }
+			log_with_session_data_endpoint(log_level::fatal, *shared_this->session_data_,
+				"Unknown error. Stop the server.");
+			shared_this->stop();
+			throw;
+		}
 	}
 
 	void server_session::stop() {
 		is_stopping_.store(true, std::memory_order_release);
-		// dispatch runs inline when already on this strand, preserving restart ordering.
-		asio::dispatch(strand_, [shared_this = shared_from_this()] {
+		// dispatch runs inline when already on this executor, preserving restart ordering.
+		asio::dispatch(executor_, [shared_this = shared_from_this()] {
 			shared_this->stop_impl();
 		});
 	}
@@ -171,8 +239,15 @@ namespace pgl {
 			catch (...) { finalize_exception = std::current_exception(); }
 		}
 
-		boost::system::error_code ignored_error;
-		connection_.close(ignored_error);
+		if (is_handshaking_on_pool_) {
+			// The handshake thread may be using the connection, so it is closed after the canceled handshake returns.
+			is_connection_close_deferred_ = true;
+			tls_handshake_canceller_.cancel();
+		}
+		else {
+			boost::system::error_code ignored_error;
+			connection_.close(ignored_error);
+		}
 
 		if (finalize_exception) { std::rethrow_exception(finalize_exception); }
 	}
@@ -191,16 +266,30 @@ namespace pgl {
 
 	void server_session::restart() {
 		if (is_stopping_.load(std::memory_order_acquire)) { return; }
-		if (session_data_) {
-			log_with_session_data_endpoint(log_level::info, *session_data_, "Server session handler is restarted.");
-		}
-		else { log(log_level::info, "Server session handler is restarted."); }
-		asio::dispatch(strand_, [shared_this = shared_from_this()] {
+		asio::dispatch(executor_, [shared_this = shared_from_this()] {
+			const auto will_wait_next_connection = shared_this->close_connection_in_pool();
+			const auto* message = will_wait_next_connection
+				? "Server session handler is restarted."
+				: "Server session handler is released.";
+			if (shared_this->session_data_) {
+				log_with_session_data_endpoint(log_level::info, *shared_this->session_data_, message);
+			}
+			else { log(log_level::info, message); }
+
 			shared_this->stop_impl();
-			shared_this->start_impl();
+			if (will_wait_next_connection) { shared_this->start_impl(); }
 		});
 	}
 
+	bool server_session::close_connection_in_pool() {
+		// A session whose acception failed is still counted as waiting.
+		if (!is_connected_) { return true; }
+
+		is_connected_ = false;
+		const auto session_pool = session_pool_.lock();
+		return session_pool && session_pool->on_connection_closed(shared_from_this());
+	}
+
 	void server_session::remove_hosting_room_if_need(const session_data& session_data) const {
 		if (session_data.is_hosting_room()) {
 			server_data_.get_room_data_container().try_remove(session_data.hosting_room_id());
@@ -9,40 +9,73 @@
 
 #include "session/session_data.hpp"
 #include "network/client_connection.hpp"
+#include "server/tls_handshake_pool.hpp"
 
 namespace pgl {
 	class message_handler_invoker;
 	class server_data;
+	class server_session_pool;
 	class server_tls_context;
 	struct server_setting;
 	class session_data;
+	class timer_wheel;
 
 	class server_session final : public std::enable_shared_from_this<server_session>, boost::noncopyable {
 	public:
+		/**
+		 * @param acceptor An acceptor to accept connections.
+		 * @param acceptor_mutex A mutex to initiate async_accept on acceptor.
+		 * @param executor An executor which serializes handlers of this session. A strand, or an executor of an I/O context run by only one thread.
+		 * @param deadline_wheel A timer wheel for send and receive deadlines, which runs on the thread running executor. nullptr to arm a timer for each operation.
+		 * @param tls_context A TLS context.
+		 * @param tls_handshake_pool A pool of threads to run TLS handshakes. nullptr to run them on executor.
+		 * @param server_data A server data.
+		 * @param server_setting A server setting.
+		 * @param message_handler_invoker A message handler invoker.
+		 * @param session_pool A session pool which this session belongs to.
+		 */
 		server_session(boost::asio::ip::tcp::acceptor& acceptor,
-			std::mutex& acceptor_mutex, server_tls_context& tls_context, server_data& server_data,
-			const server_setting& server_setting, std::shared_ptr<const message_handler_invoker> message_handler_invoker);
+			std::mutex& acceptor_mutex, boost::asio::any_io_executor executor,
+			std::shared_ptr<timer_wheel> deadline_wheel, server_tls_context& tls_context,
+			tls_handshake_pool* tls_handshake_pool, server_data& server_data, const server_setting& server_setting,
+			std::shared_ptr<const message_handler_invoker> message_handler_invoker,
+			std::weak_ptr<server_session_pool> session_pool);
 		void start();
 		void stop();
 	private:
 		boost::asio::ip::tcp::acceptor& acceptor_;
 		std::mutex& acceptor_mutex_;
 		server_tls_context& tls_context_;
+		tls_handshake_pool* tls_handshake_pool_;
 		server_data& server_data_;
 		const server_setting& server_setting_;
 		std::shared_ptr<const message_handler_invoker> message_handler_invoker_;
+		std::weak_ptr<server_session_pool> session_pool_;
 
-		// Connection operations and timeout timers share this strand through connection.get_executor().
-		boost::asio::strand<boost::asio::any_io_executor> strand_;
+		// Connection operations and timeout timers share this serializing executor through connection.get_executor().
+		boost::asio::any_io_executor executor_;
 		client_connection connection_;
 		std::unique_ptr<session_data> session_data_;
 		std::atomic_bool is_stopping_{false};
+		// Whether a connection is accepted and counted as connected by the session pool.
+		bool is_connected_ = false;
+		// While a handshake runs on the handshake pool, the connection is canceled through the pool and closed after the handshake instead of being closed by stop_impl.
+		bool is_handshaking_on_pool_ = false;
+		bool is_connection_close_deferred_ = false;
+		tls_handshake_canceller tls_handshake_canceller_;
 
 		void start_impl();
 		void stop_impl();
 		void handle_accepted_connection(const boost::system::error_code& accept_error);
+		static boost::asio::awaitable<void> handshake(std::shared_ptr<server_session> shared_this);
+		void finish_handshake_on_pool();
+		// Communicate with the accepted client until the connection is closed. shared_this keeps this session alive while the coroutine runs.
+		static boost::asio::awaitable<void> communicate(std::shared_ptr<server_session> shared_this,
+			boost::system::error_code accept_error);
 		void finalize(const session_data& session_data) const;
 		void restart();
+		// Notify the session pool that the connection is closed. Return whether this session should wait a next connection.
+		bool close_connection_in_pool();
 		void remove_hosting_room_if_need(const session_data& session_data)const;
 		void remove_player_full_name_if_need(const session_data& session_data)const;
 	};
@@ -0,0 +1,78 @@
+#include <vector>
+
+#include "server_session_pool.hpp"
+
+#include "async/io_context_concurrency.hpp"
+#include "async/timer_wheel.hpp"
+#include "logger/log.hpp"
+#include "server_session.hpp"
+#include "server_setting.hpp"
+
+namespace pgl {
+	server_session_pool::server_session_pool(boost::asio::ip::tcp::acceptor& acceptor, std::mutex& acceptor_mutex,
+		const bool is_io_context_run_by_one_thread, server_tls_context& tls_context, tls_handshake_pool* tls_handshake_pool,
+		server_data& server_data, const server_setting& server_setting,
+		std::shared_ptr<const message_handler_invoker> message_handler_invoker):
+		acceptor_(acceptor),
+		acceptor_mutex_(acceptor_mutex),
+		is_io_context_run_by_one_thread_(is_io_context_run_by_one_thread),
+		tls_context_(tls_context),
+		tls_handshake_pool_(tls_handshake_pool),
+		server_data_(server_data),
+		server_setting_(server_setting),
+		message_handler_invoker_(std::move(message_handler_invoker)),
+		counter_(server_setting.common.warm_connection_per_thread, server_setting.common.max_connection_per_thread) {
+		// A wheel is not shared by threads, so it is used only when all sessions run on the thread running the I/O context.
+		if (is_io_context_run_by_one_thread_ && server_setting_.common.timer_wheel_tick_milliseconds > 0) {
+			deadline_wheel_ = std::make_shared<timer_wheel>(acceptor_.get_executor(),
+				std::chrono::milliseconds(server_setting_.common.timer_wheel_tick_milliseconds));
+		}
+	}
+
+	void server_session_pool::start() {
+		auto session_count = 0u;
+		while (counter_.try_add_waiting_session()) {
+			add_waiting_session();
+			++session_count;
+		}
+		log(log_level::info, "Start ", session_count, " connection handlers. Up to ",
+			server_setting_.common.max_connection_per_thread, " connection handlers are added on demand.");
+	}
+
+	void server_session_pool::stop() {
+		std::vector<std::shared_ptr<server_session>> sessions;
+		{
+			std::lock_guard lock(sessions_mutex_);
+			sessions.assign(sessions_.begin(), sessions_.end());
+			sessions_.clear();
+		}
+		for (auto&& session : sessions) { session->stop(); }
+	}
+
+	void server_session_pool::on_connection_accepted() {
+		counter_.on_connection_accepted();
+		if (counter_.try_add_waiting_session()) { add_waiting_session(); }
+	}
+
+	bool server_session_pool::on_connection_closed(const std::shared_ptr<server_session>& session) {
+		if (counter_.on_connection_closed()) { return true; }
+
+		std::lock_guard lock(sessions_mutex_);
+		sessions_.erase(session);
+		return false;
+	}
+
+	const session_pool_counter& server_session_pool::counter() const { return counter_; }
+
+	void server_session_pool::add_waiting_session() {
+		auto executor = make_serialized_executor(acceptor_.get_executor(), is_io_context_run_by_one_thread_);
+		const auto session = std::make_shared<server_session>(acceptor_, acceptor_mutex_, std::move(executor),
+			deadline_wheel_, tls_context_, tls_handshake_pool_, server_data_, server_setting_, message_handler_invoker_,
+			weak_from_this());
+		{
+			std::lock_guard lock(sessions_mutex_);
+			sessions_.insert(session);
+		}
+		session->start();
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "session_pool_counter.hpp"
+
+namespace pgl {
+	class message_handler_invoker;
+	class server_data;
+	class server_session;
+	class server_tls_context;
+	struct server_setting;
+	class timer_wheel;
+	class tls_handshake_pool;
+
+	/**
+	 * A pool of sessions of a server thread which adds sessions on demand and releases them after disconnection.
+	 *
+	 * common.warm_connection_per_thread sessions are kept waiting for connections. When a waiting session accepts a connection, a new waiting session is added unless the pool has common.max_connection_per_thread sessions.
+	 * A session whose connection is closed waits a next connection if waiting sessions are fewer than the warm count, otherwise it is released.
+	 */
+	class server_session_pool final : public std::enable_shared_from_this<server_session_pool>, boost::noncopyable {
+	public:
+		/**
+		 * @param acceptor An acceptor whose I/O context runs sessions of this pool.
+		 * @param acceptor_mutex A mutex to initiate async_accept on acceptor.
+		 * @param is_io_context_run_by_one_thread Whether the I/O context of acceptor is run by only one thread. Sessions need no strand if true.
+		 * @param tls_context A TLS context.
+		 * @param tls_handshake_pool A pool of threads to run TLS handshakes. nullptr to run them on the thread of sessions.
+		 * @param server_data A server data.
+		 * @param server_setting A server setting.
+		 * @param message_handler_invoker A message handler invoker.
+		 */
+		server_session_pool(boost::asio::ip::tcp::acceptor& acceptor, std::mutex& acceptor_mutex,
+			bool is_io_context_run_by_one_thread, server_tls_context& tls_context, tls_handshake_pool* tls_handshake_pool,
+			server_data& server_data, const server_setting& server_setting,
+			std::shared_ptr<const message_handler_invoker> message_handler_invoker);
+
+		// Start warm sessions.
+		void start();
+
+		// Stop all sessions.
+		void stop();
+
+		// Called by a session which accepted a connection. A new waiting session is added if needed.
+		void on_connection_accepted();
+
+		/**
+		 * Called by a session whose connection is closed.
+		 *
+		 * @param session The session.
+		 * @return true if the session should wait a next connection. false if the session is removed from this pool.
+		 */
+		bool on_connection_closed(const std::shared_ptr<server_session>& session);
+
+		[[nodiscard]] const session_pool_counter& counter() const;
+
+	private:
+		boost::asio::ip::tcp::acceptor& acceptor_;
+		std::mutex& acceptor_mutex_;
+		bool is_io_context_run_by_one_thread_;
+		server_tls_context& tls_context_;
+		tls_handshake_pool* tls_handshake_pool_;
+		server_data& server_data_;
+		const server_setting& server_setting_;
+		std::shared_ptr<const message_handler_invoker> message_handler_invoker_;
+		// Deadlines of sessions are held by this wheel if the I/O context is run by one thread and the wheel is enabled.
+		std::shared_ptr<timer_wheel> deadline_wheel_;
+
+		session_pool_counter counter_;
+		std::mutex sessions_mutex_;
+		std::unordered_set<std::shared_ptr<server_session>> sessions_;
+
+		// Add and start a session. The session must be counted by counter_ in advance.
+		void add_waiting_session();
+	};
+}
@@ -111,33 +111,55 @@ namespace pgl {
 
 		server_common_setting s;
 		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, time_out_seconds);
+		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, timer_wheel_tick_milliseconds);
 		EXTRACT_WITH_DEFAULT(*obj, s, ip_version, ip_version);
 		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, port);
 		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, max_connection_per_thread);
+		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, warm_connection_per_thread);
 		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, thread);
 		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, max_room_count);
 		EXTRACT_WITH_DEFAULT(*obj, s, uint8_t, max_player_per_room);
+		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, room_shard_count);
+		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, list_room_reply_cache_size);
+		EXTRACT_WITH_DEFAULT(*obj, s, bool, enable_slot_map_room_storage);
+		EXTRACT_WITH_DEFAULT(*obj, s, bool, enable_reuse_port);
+		EXTRACT_WITH_DEFAULT(*obj, s, bool, enable_io_context_per_thread);
+		EXTRACT_WITH_DEFAULT(*obj, s, bool, enable_cpu_affinity);
 		return s;
 	}
 
 	void validate_common_setting(const server_common_setting& setting) {
 		validate_range(common_section_key + ".time_out_seconds", setting.time_out_seconds, 1, 3600);
+		validate_range(common_section_key + ".timer_wheel_tick_milliseconds", setting.timer_wheel_tick_milliseconds, 0,
+			10000);
 		validate_range(common_section_key + ".port", setting.port, 0, 65535);
 		validate_range(common_section_key + ".max_connection_per_thread", setting.max_connection_per_thread, 1, 65535);
+		validate_range(common_section_key + ".warm_connection_per_thread", setting.warm_connection_per_thread, 1, 65535);
 		validate_range(common_section_key + ".thread", setting.thread, 1, 65535);
 		validate_range(common_section_key + ".max_room_count", setting.max_room_count, 1, 65535);
 		validate_range(common_section_key + ".max_player_per_room", setting.max_player_per_room, 1, 255);
+		validate_range(common_section_key + ".room_shard_count", setting.room_shard_count, 1, 256);
+		validate_range(common_section_key + ".list_room_reply_cache_size", setting.list_room_reply_cache_size, 0, 1024);
 	}
 
 	void output_common_setting_to_log(const server_common_setting& setting) {
 		log(log_level::info, "--------Common--------");
 		log(log_level::info, NAMEOF(setting.time_out_seconds), ": ", setting.time_out_seconds);
+		log(log_level::info, NAMEOF(setting.timer_wheel_tick_milliseconds), ": ",
+			setting.timer_wheel_tick_milliseconds);
 		log(log_level::info, NAMEOF(setting.ip_version), ": ", setting.ip_version);
 		log(log_level::info, NAMEOF(setting.port), ": ", setting.port);
 		log(log_level::info, NAMEOF(setting.max_connection_per_thread), ": ", setting.max_connection_per_thread);
+		log(log_level::info, NAMEOF(setting.warm_connection_per_thread), ": ", setting.warm_connection_per_thread);
 		log(log_level::info, NAMEOF(setting.thread), ": ", setting.thread);
 		log(log_level::info, NAMEOF(setting.max_room_count), ": ", setting.max_room_count);
 		log(log_level::info, NAMEOF(setting.max_player_per_room), ": ", setting.max_player_per_room);
+		log(log_level::info, NAMEOF(setting.room_shard_count), ": ", setting.room_shard_count);
+		log(log_level::info, NAMEOF(setting.list_room_reply_cache_size), ": ", setting.list_room_reply_cache_size);
+		log(log_level::info, NAMEOF(setting.enable_slot_map_room_storage), ": ", setting.enable_slot_map_room_storage);
+		log(log_level::info, NAMEOF(setting.enable_reuse_port), ": ", setting.enable_reuse_port);
+		log(log_level::info, NAMEOF(setting.enable_io_context_per_thread), ": ", setting.enable_io_context_per_thread);
+		log(log_level::info, NAMEOF(setting.enable_cpu_affinity), ": ", setting.enable_cpu_affinity);
 	}
 
 	server_authentication_setting tag_invoke(json::value_to_tag<server_authentication_setting>, const json::value& jv) {
@@ -241,6 +263,12 @@ namespace pgl {
 		EXTRACT_WITH_DEFAULT(*obj, s, std::filesystem::path, certificate_path);
 		EXTRACT_WITH_DEFAULT(*obj, s, std::filesystem::path, private_key_path);
 		EXTRACT_WITH_DEFAULT(*obj, s, bool, reload_on_sighup);
+		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, session_cache_size);
+		EXTRACT_WITH_DEFAULT(*obj, s, bool, enable_session_ticket);
+		EXTRACT_WITH_DEFAULT(*obj, s, uint32_t, session_ticket_key_rotation_seconds);
+		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, handshake_thread);
+		EXTRACT_WITH_DEFAULT(*obj, s, uint16_t, max_pending_handshake);
+		EXTRACT_WITH_DEFAULT(*obj, s, bool, enable_ktls);
 		return s;
 	}
 
@@ -272,10 +300,21 @@ namespace pgl {
 		EXTRACT_WITH_DEFAULT(*tls_obj, s, std::filesystem::path, certificate_path);
 		EXTRACT_WITH_DEFAULT(*tls_obj, s, std::filesystem::path, private_key_path);
 		EXTRACT_WITH_DEFAULT(*tls_obj, s, bool, reload_on_sighup);
+		EXTRACT_WITH_DEFAULT(*tls_obj, s, uint16_t, session_cache_size);
+		EXTRACT_WITH_DEFAULT(*tls_obj, s, bool, enable_session_ticket);
+		EXTRACT_WITH_DEFAULT(*tls_obj, s, uint32_t, session_ticket_key_rotation_seconds);
+		EXTRACT_WITH_DEFAULT(*tls_obj, s, uint16_t, handshake_thread);
+		EXTRACT_WITH_DEFAULT(*tls_obj, s, uint16_t, max_pending_handshake);
+		EXTRACT_WITH_DEFAULT(*tls_obj, s, bool, enable_ktls);
 		return s;
 	}
 
 	void validate_tls_setting(const server_tls_setting& setting) {
+		validate_range(tls_section_key + ".session_ticket_key_rotation_seconds",
+			setting.session_ticket_key_rotation_seconds, 60, 86400);
+		validate_range(tls_section_key + ".handshake_thread", setting.handshake_thread, 0, 65535);
+		validate_range(tls_section_key + ".max_pending_handshake", setting.max_pending_handshake, 1, 65535);
+
 		switch (setting.mode) {
 			case server_tls_mode::plain:
 				return;
@@ -298,6 +337,13 @@ namespace pgl {
 		log(log_level::info, NAMEOF(setting.certificate_path), ": ", setting.certificate_path);
 		log(log_level::info, NAMEOF(setting.private_key_path), ": ", setting.private_key_path);
 		log(log_level::info, NAMEOF(setting.reload_on_sighup), ": ", setting.reload_on_sighup);
+		log(log_level::info, NAMEOF(setting.session_cache_size), ": ", setting.session_cache_size);
+		log(log_level::info, NAMEOF(setting.enable_session_ticket), ": ", setting.enable_session_ticket);
+		log(log_level::info, NAMEOF(setting.session_ticket_key_rotation_seconds), ": ",
+			setting.session_ticket_key_rotation_seconds);
+		log(log_level::info, NAMEOF(setting.handshake_thread), ": ", setting.handshake_thread);
+		log(log_level::info, NAMEOF(setting.max_pending_handshake), ": ", setting.max_pending_handshake);
+		log(log_level::info, NAMEOF(setting.enable_ktls), ": ", setting.enable_ktls);
 	}
 
 	void server_setting::load_from_json_file(const std::filesystem::path& file_path) {
@@ -388,12 +434,20 @@ namespace pgl {
 	void server_setting::load_from_env_var() {
 		try {
 			get_env_var("PMMS_COMMON_TIME_OUT_SECONDS", common.time_out_seconds);
+			get_env_var("PMMS_COMMON_TIMER_WHEEL_TICK_MILLISECONDS", common.timer_wheel_tick_milliseconds);
 			get_env_var<ip_version>("PMMS_COMMON_IP_VERSION", common.ip_version);
 			get_env_var("PMMS_COMMON_PORT", common.port);
 			get_env_var("PMMS_COMMON_MAX_CONNECTION_PER_THREAD", common.max_connection_per_thread);
+			get_env_var("PMMS_COMMON_WARM_CONNECTION_PER_THREAD", common.warm_connection_per_thread);
 			get_env_var("PMMS_COMMON_MAX_THREAD", common.thread);
 			get_env_var("PMMS_COMMON_MAX_ROOM_COUNT", common.max_room_count);
 			get_env_var("PMMS_COMMON_MAX_PLAYER_PER_ROOM", common.max_player_per_room);
+			get_env_var("PMMS_COMMON_ROOM_SHARD_COUNT", common.room_shard_count);
+			get_env_var("PMMS_COMMON_LIST_ROOM_REPLY_CACHE_SIZE", common.list_room_reply_cache_size);
+			get_env_var("PMMS_COMMON_ENABLE_SLOT_MAP_ROOM_STORAGE", common.enable_slot_map_room_storage);
+			get_env_var("PMMS_COMMON_ENABLE_REUSE_PORT", common.enable_reuse_port);
+			get_env_var("PMMS_COMMON_ENABLE_IO_CONTEXT_PER_THREAD", common.enable_io_context_per_thread);
+			get_env_var("PMMS_COMMON_ENABLE_CPU_AFFINITY", common.enable_cpu_affinity);
 			validate_common_setting(common);
 
 			get_env_var("PMMS_AUTHENTICATION_GAME_ID", authentication.game_id);
@@ -420,6 +474,12 @@ namespace pgl {
 			get_env_var("PMMS_TLS_CERTIFICATE_PATH", tls.certificate_path);
 			get_env_var("PMMS_TLS_PRIVATE_KEY_PATH", tls.private_key_path);
 			get_env_var("PMMS_TLS_RELOAD_ON_SIGHUP", tls.reload_on_sighup);
+			get_env_var("PMMS_TLS_SESSION_CACHE_SIZE", tls.session_cache_size);
+			get_env_var("PMMS_TLS_ENABLE_SESSION_TICKET", tls.enable_session_ticket);
+			get_env_var("PMMS_TLS_SESSION_TICKET_KEY_ROTATION_SECONDS", tls.session_ticket_key_rotation_seconds);
+			get_env_var("PMMS_TLS_HANDSHAKE_THREAD", tls.handshake_thread);
+			get_env_var("PMMS_TLS_MAX_PENDING_HANDSHAKE", tls.max_pending_handshake);
+			get_env_var("PMMS_TLS_ENABLE_KTLS", tls.enable_ktls);
 			validate_tls_setting(tls);
 		}
 		catch (const server_setting_error&) {
@@ -24,12 +24,20 @@ namespace pgl {
 
 	struct server_common_setting final {
 		uint16_t time_out_seconds = 300;
+		uint16_t timer_wheel_tick_milliseconds = 100;
 		ip_version ip_version = ip_version::v4;
 		uint16_t port = 57000;
 		uint16_t max_connection_per_thread = 1000;
+		uint16_t warm_connection_per_thread = 16;
 		uint16_t thread = 1;
 		uint16_t max_room_count = 1000;
 		uint8_t max_player_per_room = 16;
+		uint16_t room_shard_count = 1;
+		uint16_t list_room_reply_cache_size = 64;
+		bool enable_slot_map_room_storage = false;
+		bool enable_reuse_port = false;
+		bool enable_io_context_per_thread = false;
+		bool enable_cpu_affinity = false;
 	};
 
 	struct server_authentication_setting final {
@@ -57,6 +65,12 @@ namespace pgl {
 		std::filesystem::path certificate_path;
 		std::filesystem::path private_key_path;
 		bool reload_on_sighup = false;
+		uint16_t session_cache_size = 20480;
+		bool enable_session_ticket = true;
+		uint32_t session_ticket_key_rotation_seconds = 3600;
+		uint16_t handshake_thread = 0;
+		uint16_t max_pending_handshake = 1024;
+		bool enable_ktls = false;
 	};
 
 	// This class need not be thread safe because used for only read access.
@@ -2,34 +2,38 @@
 
 #include <memory>
 #include <mutex>
-#include <vector>
 
 #include <boost/asio.hpp>
 #include <boost/asio/ssl.hpp>
-
-#include "message/message_handler_invoker.hpp"
+#include <boost/noncopyable.hpp>
 
 namespace pgl {
 	class server_data;
-	class server_session;
+	class server_session_pool;
 	class server_tls_context;
 	struct server_setting;
+	class tls_handshake_pool;
 
 	class server_thread final : boost::noncopyable {
 	public:
+		/**
+		 * @param acceptor An acceptor whose I/O context runs sessions of this thread.
+		 * @param acceptor_mutex A mutex to initiate async_accept on acceptor.
+		 * @param is_io_context_run_by_one_thread Whether the I/O context of acceptor is run by only one thread. Sessions need no strand if true.
+		 * @param tls_context A TLS context.
+		 * @param tls_handshake_pool A pool of threads to run TLS handshakes. nullptr to run them on this thread.
+		 * @param server_data A server data.
+		 * @param server_setting A server setting.
+		 */
 		server_thread(boost::asio::ip::tcp::acceptor& acceptor,
-			std::mutex& acceptor_mutex, server_tls_context& tls_context, server_data& server_data,
-			const server_setting& server_setting);
+			std::mutex& acceptor_mutex, bool is_io_context_run_by_one_thread, server_tls_context& tls_context,
+			tls_handshake_pool* tls_handshake_pool, server_data& server_data, const server_setting& server_setting);
 		void start();
 		void stop();
 	private:
 		boost::asio::ip::tcp::acceptor& acceptor_;
 		std::mutex& acceptor_mutex_;
-		server_tls_context& tls_context_;
-		server_data& server_data_;
-		const server_setting& server_setting_;
-
-		std::shared_ptr<const message_handler_invoker> message_handler_invoker_;
-		std::vector<std::shared_ptr<server_session>> server_sessions_;
+		// Sessions refer this weakly because a session may be still running on other thread when this thread is finished.
+		std::shared_ptr<server_session_pool> session_pool_;
 	};
 }
@@ -1,30 +1,192 @@
 #include "server_tls_context.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/ssl.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#else
+#include <openssl/hmac.h>
+#endif
+
 namespace pgl {
+	namespace {
+		// A TLS context and ticket keys which it refers. The keys live as long as the context.
+		struct tls_context_holder final {
+			std::shared_ptr<tls_session_ticket_keys> session_ticket_keys;
+			boost::asio::ssl::context context{boost::asio::ssl::context::tls_server};
+		};
+
+		constexpr unsigned char session_id_context[] = "pmms";
+
+		// Generations are shared by all instances, so a thread cache never confuses contexts of different instances.
+		std::atomic<uint64_t> last_generation{0};
+
+		// context shares ownership of the context of an instance through a control block which only this thread counts.
+		struct thread_context_cache final {
+			uint64_t generation = 0;
+			std::shared_ptr<boost::asio::ssl::context> context;
+		};
+
+		thread_local thread_context_cache context_cache;
+
+		int session_ticket_keys_index() {
+			static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+			return index;
+		}
+
+		tls_session_ticket_keys* get_session_ticket_keys(SSL* ssl) {
+			return static_cast<tls_session_ticket_keys*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl),
+				session_ticket_keys_index()));
+		}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		using hmac_context_t = EVP_MAC_CTX;
+
+		bool init_hmac(hmac_context_t* hmac_context, std::array<uint8_t, 32>& key) {
+			char digest_name[] = "SHA256";
+			const OSSL_PARAM params[] = {
+				OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.data(), key.size()),
+				OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest_name, 0),
+				OSSL_PARAM_construct_end()
+			};
+			return EVP_MAC_CTX_set_params(hmac_context, params) == 1;
+		}
+#else
+		using hmac_context_t = HMAC_CTX;
+
+		bool init_hmac(hmac_context_t* hmac_context, std::array<uint8_t, 32>& key) {
+			return HMAC_Init_ex(hmac_context, key.data(), static_cast<int>(key.size()), EVP_sha256(), nullptr) == 1;
+		}
+#endif
+
+		/*
+		 * Encrypt or decrypt a session ticket with keys of tls_session_ticket_keys.
+		 * Return 1 to use the key, 2 to use the key and issue a new ticket with the current key, 0 to do a full handshake and -1 on error.
+		 */
+		int handle_session_ticket_key(SSL* ssl, unsigned char* key_name, unsigned char* iv,
+			EVP_CIPHER_CTX* cipher_context, hmac_context_t* hmac_context, const int is_encryption) noexcept {
+			auto* const keys = get_session_ticket_keys(ssl);
+			if (keys == nullptr) { return -1; }
+
+			try {
+				if (is_encryption) {
+					auto key = keys->encryption_key();
+					std::copy(key.name.begin(), key.name.end(), key_name);
+					if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1) { return -1; }
+					if (EVP_EncryptInit_ex(cipher_context, EVP_aes_256_cbc(), nullptr, key.aes_key.data(), iv) != 1) {
+						return -1;
+					}
+					return init_hmac(hmac_context, key.hmac_key) ? 1 : -1;
+				}
+
+				tls_session_ticket_keys::key_name_t name;
+				std::copy_n(key_name, name.size(), name.begin());
+				auto found_key = keys->find_decryption_key(name);
+				if (!found_key) { return 0; }
+				auto& [key, is_current_key] = *found_key;
+				if (EVP_DecryptInit_ex(cipher_context, EVP_aes_256_cbc(), nullptr, key.aes_key.data(), iv) != 1) {
+					return -1;
+				}
+				if (!init_hmac(hmac_context, key.hmac_key)) { return -1; }
+				return is_current_key ? 1 : 2;
+			}
+			catch (...) { return -1; }
+		}
+	}
+
 	std::shared_ptr<boost::asio::ssl::context> server_tls_context::make_context(
 		const server_tls_setting& setting) {
 		if (setting.mode != server_tls_mode::tls) { return {}; }
 
-		auto context = std::make_shared<boost::asio::ssl::context>(boost::asio::ssl::context::tls_server);
-		context->set_options(
+		auto holder = std::make_shared<tls_context_holder>();
+		auto& context = holder->context;
+		context.set_options(
 			boost::asio::ssl::context::default_workarounds |
 			boost::asio::ssl::context::no_sslv2 |
 			boost::asio::ssl::context::no_sslv3 |
 			boost::asio::ssl::context::no_tlsv1 |
 			boost::asio::ssl::context::no_tlsv1_1);
-		context->use_certificate_chain_file(setting.certificate_path.string());
-		context->use_private_key_file(setting.private_key_path.string(), boost::asio::ssl::context::pem);
-		return context;
+		context.use_certificate_chain_file(setting.certificate_path.string());
+		context.use_private_key_file(setting.private_key_path.string(), boost::asio::ssl::context::pem);
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS)
+		// Connections check this option to read and write through kTLS.
+		if (setting.enable_ktls) { context.set_options(SSL_OP_ENABLE_KTLS); }
+#endif
+
+		// Set up session resumption so that reconnecting clients skip the asymmetric key exchange.
+		auto* const native_context = context.native_handle();
+		SSL_CTX_set_session_id_context(native_context, session_id_context, sizeof(session_id_context) - 1);
+		SSL_CTX_set_timeout(native_context, static_cast<long>(setting.session_ticket_key_rotation_seconds));
+		if (setting.session_cache_size > 0) {
+			SSL_CTX_set_session_cache_mode(native_context, SSL_SESS_CACHE_SERVER);
+			SSL_CTX_sess_set_cache_size(native_context, setting.session_cache_size);
+		}
+		else { SSL_CTX_set_session_cache_mode(native_context, SSL_SESS_CACHE_OFF); }
+
+		if (setting.enable_session_ticket) {
+			{
+				std::lock_guard lock(mutex_);
+				const auto rotation_interval = std::chrono::seconds(setting.session_ticket_key_rotation_seconds);
+				if (session_ticket_keys_) { session_ticket_keys_->set_rotation_interval(rotation_interval); }
+				else { session_ticket_keys_ = std::make_shared<tls_session_ticket_keys>(rotation_interval); }
+				holder->session_ticket_keys = session_ticket_keys_;
+			}
+			SSL_CTX_set_ex_data(native_context, session_ticket_keys_index(), holder->session_ticket_keys.get());
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+			SSL_CTX_set_tlsext_ticket_key_evp_cb(native_context, handle_session_ticket_key);
+#else
+			SSL_CTX_set_tlsext_ticket_key_cb(native_context, handle_session_ticket_key);
+#endif
+		}
+		else {
+			// TLS 1.3 then issues tickets which refer the session cache instead of stateless tickets.
+			context.set_options(SSL_OP_NO_TICKET);
+		}
+
+		return {holder, &holder->context};
+	}
+
+	server_tls_context::~server_tls_context() {
+		if (context_cache.generation == generation_.load(std::memory_order_relaxed)) { context_cache = {}; }
 	}
 
 	void server_tls_context::reload(const server_tls_setting& setting) {
 		auto context = make_context(setting);
 		std::lock_guard lock(mutex_);
 		context_ = std::move(context);
+		// Threads see the new generation after this returns and fetch the new context on their next call.
+		generation_.store(last_generation.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_release);
 	}
 
-	std::shared_ptr<boost::asio::ssl::context> server_tls_context::current() const {
-		std::lock_guard lock(mutex_);
-		return context_;
+	const std::shared_ptr<boost::asio::ssl::context>& server_tls_context::current() const {
+		if (context_cache.generation != generation_.load(std::memory_order_acquire)) {
+			// Release the context of the previous generation, which may belong to another instance, before waiting for the mutex.
+			context_cache = {};
+			std::lock_guard lock(mutex_);
+			context_cache.generation = generation_.load(std::memory_order_relaxed);
+			if (context_) {
+				auto owner = std::make_shared<std::shared_ptr<boost::asio::ssl::context>>(context_);
+				context_cache.context = {owner, owner->get()};
+			}
+		}
+
+		return context_cache.context;
+	}
+
+	void server_tls_context::on_handshake_completed(const bool is_session_resumed) {
+		handshake_count_.fetch_add(1, std::memory_order_relaxed);
+		if (is_session_resumed) { resumed_handshake_count_.fetch_add(1, std::memory_order_relaxed); }
+	}
+
+	uint64_t server_tls_context::handshake_count() const { return handshake_count_.load(std::memory_order_relaxed); }
+
+	uint64_t server_tls_context::resumed_handshake_count() const {
+		return resumed_handshake_count_.load(std::memory_order_relaxed);
 	}
 }
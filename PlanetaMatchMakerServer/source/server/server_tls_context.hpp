@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 
@@ -7,17 +9,50 @@
 #include <boost/noncopyable.hpp>
 
 #include "server_setting.hpp"
+#include "tls_session_ticket_keys.hpp"
 
 namespace pgl {
 	class server_tls_context final : boost::noncopyable {
 	public:
+		// Drop the context which the calling thread caches. Other threads drop it on their next call of current() or at exit.
+		~server_tls_context();
+
+		/**
+		 * Load a certificate and a private key and make a new TLS context for following connections.
+		 * Session ticket keys are kept, so tickets issued by the previous context are still accepted.
+		 *
+		 * @param setting A TLS setting.
+		 * @throw boost::system::system_error Failed to load the certificate or the private key.
+		 */
 		void reload(const server_tls_setting& setting);
-		[[nodiscard]] std::shared_ptr<boost::asio::ssl::context> current() const;
+
+		/**
+		 * Get the context made by the last reload. nullptr if no context is loaded.
+		 * Each thread caches the context and takes the mutex only after a reload, so threads accepting connections do not contend.
+		 * The cached pointer has a reference count owned by the thread, so copying it does not touch a count shared with other threads.
+		 *
+		 * @return A pointer cached by the calling thread. It is valid until the next call of current() of any instance on the same thread.
+		 */
+		[[nodiscard]] const std::shared_ptr<boost::asio::ssl::context>& current() const;
+
+		// Count a completed handshake. This is thread safe.
+		void on_handshake_completed(bool is_session_resumed);
+
+		[[nodiscard]] uint64_t handshake_count() const;
+
+		// Get the number of handshakes which resumed a session by a session ticket or the session cache.
+		[[nodiscard]] uint64_t resumed_handshake_count() const;
 
 	private:
-		static std::shared_ptr<boost::asio::ssl::context> make_context(const server_tls_setting& setting);
+		std::shared_ptr<boost::asio::ssl::context> make_context(const server_tls_setting& setting);
 
 		mutable std::mutex mutex_;
 		std::shared_ptr<boost::asio::ssl::context> context_;
+		// A generation of context_ which is unique among all instances. 0 if no context is loaded.
+		std::atomic<uint64_t> generation_{0};
+		// Created by the first reload with session tickets enabled and kept across reloads.
+		std::shared_ptr<tls_session_ticket_keys> session_ticket_keys_;
+		std::atomic<uint64_t> handshake_count_{0};
+		std::atomic<uint64_t> resumed_handshake_count_{0};
 	};
 }
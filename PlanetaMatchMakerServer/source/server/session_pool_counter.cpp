@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "session_pool_counter.hpp"
+
+namespace pgl {
+	session_pool_counter::session_pool_counter(const size_t warm_session_count, const size_t max_session_count) :
+		warm_session_count_(std::min(warm_session_count, max_session_count)),
+		max_session_count_(max_session_count) {
+		if (warm_session_count == 0 || max_session_count == 0) {
+			throw std::invalid_argument("Session counts of session_pool_counter must not be 0.");
+		}
+	}
+
+	bool session_pool_counter::try_add_waiting_session() {
+		std::lock_guard lock(mutex_);
+		if (waiting_session_count_ >= warm_session_count_
+			|| waiting_session_count_ + connected_session_count_ >= max_session_count_) { return false; }
+
+		++waiting_session_count_;
+		return true;
+	}
+
+	void session_pool_counter::on_connection_accepted() {
+		std::lock_guard lock(mutex_);
+		--waiting_session_count_;
+		++connected_session_count_;
+		peak_connected_session_count_ = std::max(peak_connected_session_count_, connected_session_count_);
+	}
+
+	bool session_pool_counter::on_connection_closed() {
+		std::lock_guard lock(mutex_);
+		--connected_session_count_;
+		if (waiting_session_count_ >= warm_session_count_) { return false; }
+
+		++waiting_session_count_;
+		return true;
+	}
+
+	size_t session_pool_counter::session_count() const {
+		std::lock_guard lock(mutex_);
+		return waiting_session_count_ + connected_session_count_;
+	}
+
+	size_t session_pool_counter::waiting_session_count() const {
+		std::lock_guard lock(mutex_);
+		return waiting_session_count_;
+	}
+
+	size_t session_pool_counter::connected_session_count() const {
+		std::lock_guard lock(mutex_);
+		return connected_session_count_;
+	}
+
+	size_t session_pool_counter::peak_connected_session_count() const {
+		std::lock_guard lock(mutex_);
+		return peak_connected_session_count_;
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+#include <boost/noncopyable.hpp>
+
+namespace pgl {
+	/**
+	 * Thread safe counts of sessions in a session pool, which decide when the pool adds or releases sessions.
+	 *
+	 * A session is waiting while it accepts a connection, and connected while it processes the accepted connection.
+	 * The pool keeps up to warm session count sessions waiting and never has more than max session count sessions.
+	 */
+	class session_pool_counter final : boost::noncopyable {
+	public:
+		/**
+		 * Create a session pool counter.
+		 *
+		 * @param warm_session_count The number of sessions to keep waiting. Limited to max_session_count.
+		 * @param max_session_count The maximum number of sessions.
+		 * @throw std::invalid_argument warm_session_count or max_session_count is 0.
+		 */
+		session_pool_counter(size_t warm_session_count, size_t max_session_count);
+
+		/**
+		 * Count a new waiting session if waiting sessions are less than the warm session count and sessions are less than the max session count.
+		 *
+		 * @return Whether a new session should be added.
+		 */
+		[[nodiscard]] bool try_add_waiting_session();
+
+		// Count a waiting session which accepted a connection as connected.
+		void on_connection_accepted();
+
+		/**
+		 * Count a connected session whose connection is closed.
+		 *
+		 * @return true if the session should wait a next connection. false if it should be released.
+		 */
+		[[nodiscard]] bool on_connection_closed();
+
+		[[nodiscard]] size_t session_count() const;
+
+		[[nodiscard]] size_t waiting_session_count() const;
+
+		[[nodiscard]] size_t connected_session_count() const;
+
+		// The maximum number of connected sessions at the same time.
+		[[nodiscard]] size_t peak_connected_session_count() const;
+
+	private:
+		const size_t warm_session_count_;
+		const size_t max_session_count_;
+		mutable std::mutex mutex_;
+		size_t waiting_session_count_ = 0;
+		size_t connected_session_count_ = 0;
+		size_t peak_connected_session_count_ = 0;
+	};
+}
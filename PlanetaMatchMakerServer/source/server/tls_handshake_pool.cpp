@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#include "tls_handshake_pool.hpp"
+
+#include "async/io_context_concurrency.hpp"
+#include "async/timer.hpp"
+#include "logger/log.hpp"
+#include "network/client_connection.hpp"
+
+using namespace boost;
+
+namespace pgl {
+	namespace {
+		// A connection seen by execute_socket_timed_async_operation, whose timer runs on a handshake thread instead of the executor of the session.
+		class handshake_socket final {
+		public:
+			handshake_socket(client_connection& connection, asio::any_io_executor executor):
+				connection_(connection), executor_(std::move(executor)) {}
+
+			[[nodiscard]] asio::any_io_executor get_executor() const { return executor_; }
+
+			void cancel(boost::system::error_code& error_code) { connection_.cancel(error_code); }
+
+		private:
+			client_connection& connection_;
+			asio::any_io_executor executor_;
+		};
+	}
+
+	void tls_handshake_canceller::cancel() const {
+		if (!state_) { return; }
+		asio::post(state_->executor, [state = state_] {
+			if (state->connection == nullptr) { return; }
+			boost::system::error_code ignored_error;
+			state->connection->cancel(ignored_error);
+		});
+	}
+
+	tls_handshake_pool::tls_handshake_pool(const size_t thread_count, const size_t max_pending_handshake_count):
+		thread_count_(thread_count),
+		max_pending_handshake_count_(max_pending_handshake_count),
+		io_context_(get_io_context_concurrency_hint(thread_count == 1)),
+		work_guard_(asio::make_work_guard(io_context_)) {
+		if (thread_count == 0) { throw std::invalid_argument("thread_count must be positive."); }
+		if (max_pending_handshake_count == 0) {
+			throw std::invalid_argument("max_pending_handshake_count must be positive.");
+		}
+
+		threads_.reserve(thread_count);
+		for (auto i = 0u; i < thread_count; ++i) {
+			threads_.emplace_back([this] {
+				try { io_context_.run(); }
+				catch (const std::exception& e) {
+					log(log_level::error, "TLS handshake thread is stopped by an error: ", e.what());
+				}
+			});
+		}
+	}
+
+	tls_handshake_pool::~tls_handshake_pool() {
+		work_guard_.reset();
+		io_context_.stop();
+		for (auto&& thread : threads_) { thread.join(); }
+	}
+
+	asio::awaitable<bool> tls_handshake_pool::async_handshake(client_connection& connection,
+		const std::chrono::steady_clock::duration time_out, tls_handshake_canceller& canceller) {
+		if (!try_add_pending_handshake()) { co_return false; }
+
+		auto executor = make_serialized_executor(io_context_.get_executor(), thread_count_ == 1);
+		canceller.state_ = std::make_shared<tls_handshake_canceller::state>(tls_handshake_canceller::state{
+			executor, &connection
+		});
+		auto handshake = handshake_on_pool_thread(connection, time_out, canceller.state_);
+		try { co_await asio::co_spawn(executor, std::move(handshake), asio::use_awaitable); }
+		catch (...) {
+			remove_pending_handshake();
+			throw;
+		}
+
+		remove_pending_handshake();
+		co_return true;
+	}
+
+	size_t tls_handshake_pool::pending_handshake_count() const {
+		std::lock_guard lock(mutex_);
+		return pending_handshake_count_;
+	}
+
+	size_t tls_handshake_pool::peak_pending_handshake_count() const {
+		std::lock_guard lock(mutex_);
+		return peak_pending_handshake_count_;
+	}
+
+	size_t tls_handshake_pool::refused_handshake_count() const {
+		std::lock_guard lock(mutex_);
+		return refused_handshake_count_;
+	}
+
+	bool tls_handshake_pool::try_add_pending_handshake() {
+		std::lock_guard lock(mutex_);
+		if (pending_handshake_count_ >= max_pending_handshake_count_) {
+			++refused_handshake_count_;
+			return false;
+		}
+
+		++pending_handshake_count_;
+		peak_pending_handshake_count_ = std::max(peak_pending_handshake_count_, pending_handshake_count_);
+		return true;
+	}
+
+	asio::awaitable<void> tls_handshake_pool::handshake_on_pool_thread(client_connection& connection,
+		const std::chrono::steady_clock::duration time_out,
+		const std::shared_ptr<tls_handshake_canceller::state> canceller_state) {
+		handshake_socket socket(connection, co_await asio::this_coro::executor);
+		// Detach the canceller on this thread, so a cancel which runs later does not touch the connection.
+		try { co_await execute_socket_timed_async_operation(socket, time_out, connection.async_handshake()); }
+		catch (...) {
+			canceller_state->connection = nullptr;
+			throw;
+		}
+		canceller_state->connection = nullptr;
+	}
+
+	void tls_handshake_pool::remove_pending_handshake() {
+		std::lock_guard lock(mutex_);
+		--pending_handshake_count_;
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace pgl {
+	class client_connection;
+	class tls_handshake_pool;
+
+	/**
+	 * A handle to cancel a handshake which runs on tls_handshake_pool from the executor of the session.
+	 *
+	 * The connection is canceled on the handshake thread, so it is not touched by two threads at once. Canceling after the handshake finished does nothing.
+	 */
+	class tls_handshake_canceller final {
+	public:
+		// Cancel the handshake. The handshake fails with boost::asio::error::operation_aborted.
+		void cancel() const;
+
+	private:
+		friend class tls_handshake_pool;
+
+		struct state final {
+			boost::asio::any_io_executor executor;
+			// nullptr after the handshake finished. Only accessed on executor.
+			client_connection* connection;
+		};
+
+		std::shared_ptr<state> state_;
+	};
+
+	/**
+	 * Threads which run TLS handshakes apart from threads which handle messages, so that a reconnect storm does not delay messages of connected clients.
+	 *
+	 * Handshakes wait in the queue of the I/O context of this pool while all handshake threads are busy. Up to max pending handshake count handshakes are queued or running at once, and more handshakes are refused.
+	 * This is thread safe.
+	 */
+	class tls_handshake_pool final : boost::noncopyable {
+	public:
+		/**
+		 * Create a pool and start its threads.
+		 *
+		 * @param thread_count The number of handshake threads.
+		 * @param max_pending_handshake_count The maximum number of queued or running handshakes.
+		 * @throw std::invalid_argument thread_count or max_pending_handshake_count is 0.
+		 */
+		tls_handshake_pool(size_t thread_count, size_t max_pending_handshake_count);
+
+		// Stop and join threads. Handshakes which are not finished are abandoned.
+		~tls_handshake_pool();
+
+		/**
+		 * Run a TLS handshake of a connection on a handshake thread, and resume the caller on its executor after the handshake.
+		 * The connection must not be used by others until this completes. Use canceller to stop the handshake instead of closing the connection.
+		 *
+		 * @param connection A connection to handshake.
+		 * @param time_out A time limit of the handshake.
+		 * @param canceller A handle which is bound to this handshake.
+		 * @return false if the handshake is refused because max pending handshake count handshakes are pending.
+		 * @throw boost::system::system_error The handshake failed or timed out.
+		 */
+		boost::asio::awaitable<bool> async_handshake(client_connection& connection,
+			std::chrono::steady_clock::duration time_out, tls_handshake_canceller& canceller);
+
+		// The number of handshakes which are queued or running.
+		[[nodiscard]] size_t pending_handshake_count() const;
+
+		// The maximum number of pending handshakes at the same time.
+		[[nodiscard]] size_t peak_pending_handshake_count() const;
+
+		[[nodiscard]] size_t refused_handshake_count() const;
+
+	private:
+		const size_t thread_count_;
+		const size_t max_pending_handshake_count_;
+		boost::asio::io_context io_context_;
+		boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_;
+		std::vector<std::thread> threads_;
+
+		mutable std::mutex mutex_;
+		size_t pending_handshake_count_ = 0;
+		size_t peak_pending_handshake_count_ = 0;
+		size_t refused_handshake_count_ = 0;
+
+		[[nodiscard]] bool try_add_pending_handshake();
+		void remove_pending_handshake();
+
+		static boost::asio::awaitable<void> handshake_on_pool_thread(client_connection& connection,
+			std::chrono::steady_clock::duration time_out, std::shared_ptr<tls_handshake_canceller::state> canceller_state);
+	};
+}
@@ -0,0 +1,68 @@
+#include "tls_session_ticket_keys.hpp"
+
+#include <stdexcept>
+
+#include <openssl/rand.h>
+
+namespace pgl {
+	namespace {
+		template <size_t Size>
+		void fill_random_bytes(std::array<uint8_t, Size>& bytes) {
+			if (RAND_bytes(bytes.data(), static_cast<int>(bytes.size())) != 1) {
+				throw std::runtime_error("Failed to generate random bytes for a TLS session ticket key.");
+			}
+		}
+	}
+
+	tls_session_ticket_keys::tls_session_ticket_keys(const std::chrono::steady_clock::duration rotation_interval) {
+		set_rotation_interval(rotation_interval);
+		keys_.reserve(3);
+	}
+
+	tls_session_ticket_keys::key tls_session_ticket_keys::encryption_key() {
+		std::lock_guard lock(mutex_);
+		rotate_if_needed(std::chrono::steady_clock::now());
+		return keys_.front();
+	}
+
+	std::optional<std::pair<tls_session_ticket_keys::key, bool>> tls_session_ticket_keys::find_decryption_key(
+		const key_name_t& name) {
+		std::lock_guard lock(mutex_);
+		rotate_if_needed(std::chrono::steady_clock::now());
+		for (auto i = 0u; i < keys_.size(); ++i) {
+			if (keys_[i].name == name) { return std::make_pair(keys_[i], i == 0); }
+		}
+
+		return std::nullopt;
+	}
+
+	void tls_session_ticket_keys::set_rotation_interval(const std::chrono::steady_clock::duration rotation_interval) {
+		if (rotation_interval <= std::chrono::steady_clock::duration::zero()) {
+			throw std::invalid_argument("Rotation interval of TLS session ticket keys must be positive.");
+		}
+
+		std::lock_guard lock(mutex_);
+		rotation_interval_ = rotation_interval;
+	}
+
+	std::chrono::steady_clock::duration tls_session_ticket_keys::rotation_interval() const {
+		std::lock_guard lock(mutex_);
+		return rotation_interval_;
+	}
+
+	void tls_session_ticket_keys::rotate_if_needed(const std::chrono::steady_clock::time_point now) {
+		if (!keys_.empty() && now - keys_.front().created_time < rotation_interval_) { return; }
+
+		// The previous key has been kept for one interval after the current key replaced it, so it expires now.
+		if (keys_.size() == 2) { keys_.pop_back(); }
+		// Drop the current key too if it is too old to be the previous key.
+		if (!keys_.empty() && now - keys_.front().created_time >= rotation_interval_ * 2) { keys_.clear(); }
+
+		key new_key{};
+		fill_random_bytes(new_key.name);
+		fill_random_bytes(new_key.hmac_key);
+		fill_random_bytes(new_key.aes_key);
+		new_key.created_time = now;
+		keys_.insert(keys_.begin(), new_key);
+	}
+}
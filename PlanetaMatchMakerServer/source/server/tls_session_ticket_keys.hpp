@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+namespace pgl {
+	/**
+	 * Keys to encrypt and decrypt stateless TLS session tickets.
+	 *
+	 * Keys are generated randomly in memory and never written to disk. A new key is used after the rotation interval, and the previous key still decrypts tickets for one more interval.
+	 * Keys are independent of certificates, so tickets are accepted across TLS context reloads. This is thread safe.
+	 */
+	class tls_session_ticket_keys final : boost::noncopyable {
+	public:
+		using key_name_t = std::array<uint8_t, 16>;
+
+		struct key final {
+			key_name_t name;
+			std::array<uint8_t, 32> hmac_key;
+			std::array<uint8_t, 32> aes_key;
+			std::chrono::steady_clock::time_point created_time;
+		};
+
+		/**
+		 * @param rotation_interval An interval to use a new key.
+		 * @throw std::invalid_argument rotation_interval is not positive.
+		 */
+		explicit tls_session_ticket_keys(std::chrono::steady_clock::duration rotation_interval);
+
+		/**
+		 * Get a key to encrypt a new ticket. A new key is generated if the current key is older than the rotation interval.
+		 *
+		 * @throw std::runtime_error Failed to generate random bytes.
+		 */
+		[[nodiscard]] key encryption_key();
+
+		/**
+		 * Find a key to decrypt a ticket.
+		 *
+		 * @param name A name of the key in the ticket.
+		 * @return A key and whether it is the current key. std::nullopt if the key is expired or unknown.
+		 */
+		[[nodiscard]] std::optional<std::pair<key, bool>> find_decryption_key(const key_name_t& name);
+
+		// Set the interval to use a new key. This is applied from the next rotation.
+		void set_rotation_interval(std::chrono::steady_clock::duration rotation_interval);
+
+		[[nodiscard]] std::chrono::steady_clock::duration rotation_interval() const;
+
+	private:
+		mutable std::mutex mutex_;
+		std::chrono::steady_clock::duration rotation_interval_;
+		// The current key first and the previous key next.
+		std::vector<key> keys_;
+
+		void rotate_if_needed(std::chrono::steady_clock::time_point now);
+	};
+}
@@ -8,8 +8,8 @@
 #include "session_constants.hpp"
 
 namespace pgl {
-	// This class need not be thread safe because one session is processed serially through its session strand.
-	// Do not access it from outside the owning session strand.
+	// This class need not be thread safe because one session is processed serially through its session executor.
+	// Do not access it from outside the owning session executor.
 	// Each method may throw std::runtime_exception if errors occur.
 	class session_data final {
 	public:
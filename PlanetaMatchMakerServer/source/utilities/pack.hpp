@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "minimal_serializer/string_utility.hpp"
 #include "minimal_serializer/serializer.hpp"
@@ -18,10 +21,10 @@ namespace pgl {
 	constexpr size_t get_packed_size() { return (minimal_serializer::serialized_size_v<Data> + ...); }
 
 	template <size_t Pos>
-	void pack_data_impl(std::vector<uint8_t>&) {}
+	void pack_data_impl(std::span<uint8_t>) {}
 
 	template <size_t Pos, serializable First, serializable ... Rests>
-	void pack_data_impl(std::vector<uint8_t>& buffer, const First& first, const Rests& ... rests) {
+	void pack_data_impl(std::span<uint8_t> buffer, const First& first, const Rests& ... rests) {
 		constexpr auto size = minimal_serializer::serialized_size_v<First>;
 		if (Pos + size > buffer.size()) {
 			auto message = minimal_serializer::generate_string("Data range(pos=", Pos, ", size=", size,
@@ -50,11 +53,36 @@ namespace pgl {
 		return buffer;
 	}
 
+	/**
+	 * A fixed size byte array which can hold serialized multiple data.
+	 *
+	 * @tparam Data Types of data.
+	 */
+	template <serializable... Data>
+	using packed_data = std::array<uint8_t, get_packed_size<Data...>()>;
+
+	/**
+	 * Serialize multiple data into a fixed size byte array without heap allocation.
+	 *
+	 * @param first First data to serialize.
+	 * @param rests Rest data to serialize.
+	 * @tparam First A type of first data.
+	 * @tparam Rests Types of rest data.
+	 * @return A byte array of serialized data.
+	 * @exception minimal_serializer::serialization_error Failed to serialize.
+	 */
+	template <serializable First, serializable... Rests>
+	packed_data<First, Rests...> pack_data_to_array(const First& first, const Rests& ... rests) {
+		packed_data<First, Rests...> buffer;
+		pack_data_impl<0>(buffer, first, rests...);
+		return buffer;
+	}
+
 	template <size_t Pos>
-	void unpack_data_impl(const std::vector<uint8_t>&) {}
+	void unpack_data_impl(std::span<const uint8_t>) {}
 
 	template <size_t Pos, serializable First, serializable ... Rests>
-	void unpack_data_impl(const std::vector<uint8_t>& buffer, First& first, Rests& ... rests) {
+	void unpack_data_impl(const std::span<const uint8_t> buffer, First& first, Rests& ... rests) {
 		constexpr auto size = minimal_serializer::serialized_size_v<First>;
 		if (Pos + size > buffer.size()) {
 			auto message = minimal_serializer::generate_string("Data range(pos=", Pos, ", size=", size,
@@ -77,7 +105,7 @@ namespace pgl {
 	 */
 	template <typename First, typename ... Rests> requires(serializable_all<First, Rests...> && not_constant_all<First,
 		Rests...>)
-	void unpack_data(const std::vector<uint8_t>& buffer, First& first, Rests& ... rests) {
+	void unpack_data(const std::span<const uint8_t> buffer, First& first, Rests& ... rests) {
 		unpack_data_impl<0>(buffer, first, rests...);
 	}
 }
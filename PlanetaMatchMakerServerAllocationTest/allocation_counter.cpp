@@ -0,0 +1,33 @@
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counter.hpp"
+
+// The global allocation functions are replaced for this whole executable, so this test is built apart from PlanetaMatchMakerServerTest.
+// They are defined in this translation unit alone so that the compiler does not inline them and mismatch malloc with delete.
+namespace {
+	thread_local bool is_allocation_counted = false;
+	thread_local size_t allocation_count = 0;
+}
+
+namespace pgl::test {
+	void start_allocation_count() {
+		allocation_count = 0;
+		is_allocation_counted = true;
+	}
+
+	size_t stop_allocation_count() {
+		is_allocation_counted = false;
+		return allocation_count;
+	}
+}
+
+void* operator new(const std::size_t size) {
+	if (is_allocation_counted) { ++allocation_count; }
+	if (auto* const pointer = std::malloc(size == 0 ? 1 : size)) { return pointer; }
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
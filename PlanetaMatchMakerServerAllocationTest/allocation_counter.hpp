@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+namespace pgl::test {
+	// Start counting heap allocations of the calling thread.
+	void start_allocation_count();
+
+	// Stop counting heap allocations of the calling thread and return the number of them since start_allocation_count.
+	size_t stop_allocation_count();
+
+	// Count heap allocations of the current thread while body runs.
+	template <typename Body>
+	size_t count_allocations(Body&& body) {
+		start_allocation_count();
+		body();
+		return stop_allocation_count();
+	}
+}
@@ -2,12 +2,16 @@
 
 #include "../../PlanetaMatchMakerServer/source/server/server_session.hpp"
 #include "../../PlanetaMatchMakerServer/source/server/server_tls_context.hpp"
+#include "../../PlanetaMatchMakerServer/source/server/tls_handshake_pool.hpp"
 
 #include "protocol_test_support.hpp"
 
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <string>
+#include <string_view>
 
 namespace {
 	using namespace pgl::test;
@@ -163,7 +167,8 @@ BOOST_AUTO_TEST_SUITE(authentication_protocol_test)
 		tls_context.reload(setting.tls);
 		const auto invoker = pgl::message_handler_invoker_factory::make_shared_standard();
 		const auto session = std::make_shared<pgl::server_session>(
-			acceptor, acceptor_mutex, tls_context, server_data, setting, invoker);
+			acceptor, acceptor_mutex, boost::asio::make_strand(server_io), nullptr, tls_context, nullptr, server_data,
+			setting, invoker, std::weak_ptr<pgl::server_session_pool>());
 		session->start();
 		io_context_thread server_thread(server_io);
 
@@ -197,6 +202,397 @@ BOOST_AUTO_TEST_SUITE(authentication_protocol_test)
 		server_io.stop();
 	}
 
+	BOOST_AUTO_TEST_CASE(test_tls_connection_resumes_session_by_ticket_across_reload) {
+		boost::asio::io_context server_io;
+		tcp::acceptor acceptor(server_io, tcp::endpoint(tcp::v4(), 0));
+		std::mutex acceptor_mutex;
+		pgl::server_data server_data;
+		auto setting = make_protocol_test_setting();
+		setting.tls.mode = pgl::server_tls_mode::tls;
+		const tls_test_certificate_files certificate_files;
+		setting.tls.certificate_path = certificate_files.certificate_path();
+		setting.tls.private_key_path = certificate_files.private_key_path();
+		pgl::server_tls_context tls_context;
+		tls_context.reload(setting.tls);
+		const auto invoker = pgl::message_handler_invoker_factory::make_shared_standard();
+		std::vector<std::shared_ptr<pgl::server_session>> sessions;
+		for (auto i = 0; i < 2; ++i) {
+			sessions.push_back(std::make_shared<pgl::server_session>(
+				acceptor, acceptor_mutex, boost::asio::make_strand(server_io), nullptr, tls_context, nullptr,
+				server_data, setting, invoker, std::weak_ptr<pgl::server_session_pool>()));
+			sessions.back()->start();
+		}
+		io_context_thread server_thread(server_io);
+
+		boost::asio::io_context client_io;
+		boost::asio::ssl::context client_ssl_context(boost::asio::ssl::context::tls_client);
+		client_ssl_context.set_verify_mode(boost::asio::ssl::verify_none);
+		const tcp::endpoint server_endpoint(boost::asio::ip::address_v4::loopback(), acceptor.local_endpoint().port());
+		SSL_SESSION* client_session = nullptr;
+		std::vector<bool> resumed;
+		for (const auto* player_name : {u8"first-player", u8"second-player"}) {
+			boost::asio::ssl::stream<tcp::socket> client_stream(client_io, client_ssl_context);
+			if (client_session != nullptr) { SSL_set_session(client_stream.native_handle(), client_session); }
+			client_stream.lowest_layer().connect(server_endpoint);
+			client_stream.handshake(boost::asio::ssl::stream_base::client);
+			const pgl::authentication_request_message request{
+				pgl::api_version,
+				pgl::game_id_t(setting.authentication.game_id),
+				pgl::game_version_t(setting.authentication.game_version),
+				player_name
+			};
+			write_packed_to_stream(client_stream, pgl::request_message_header{pgl::message_type::authentication},
+				request);
+			// TLS 1.3 sends tickets after the handshake, so the client has received them when the reply is read.
+			const auto reply = read_packed_from_stream<pgl::authentication_reply_message>(client_stream);
+			BOOST_CHECK(reply.result == pgl::authentication_result::success);
+			resumed.push_back(SSL_session_reused(client_stream.native_handle()) == 1);
+			if (client_session != nullptr) { SSL_SESSION_free(client_session); }
+			client_session = SSL_get1_session(client_stream.native_handle());
+
+			boost::system::error_code ignored_error;
+			client_stream.shutdown(ignored_error);
+			client_stream.lowest_layer().close(ignored_error);
+
+			// Tickets must be accepted by a new context because ticket keys are kept across reloads.
+			tls_context.reload(setting.tls);
+		}
+		SSL_SESSION_free(client_session);
+
+		BOOST_CHECK(!resumed[0]);
+		BOOST_CHECK(resumed[1]);
+		BOOST_CHECK_EQUAL(tls_context.handshake_count(), 2);
+		BOOST_CHECK_EQUAL(tls_context.resumed_handshake_count(), 1);
+		for (const auto& session : sessions) { session->stop(); }
+		server_io.stop();
+	}
+
+	BOOST_AUTO_TEST_CASE(test_tls_context_reload_is_seen_by_every_thread_immediately) {
+		auto setting = make_protocol_test_setting();
+		setting.tls.mode = pgl::server_tls_mode::tls;
+		const tls_test_certificate_files certificate_files;
+		setting.tls.certificate_path = certificate_files.certificate_path();
+		setting.tls.private_key_path = certificate_files.private_key_path();
+		pgl::server_tls_context tls_context;
+		BOOST_CHECK(!tls_context.current());
+		tls_context.reload(setting.tls);
+		const auto first_context = tls_context.current();
+		std::shared_ptr<boost::asio::ssl::context> other_thread_first_context;
+		std::thread([&] { other_thread_first_context = tls_context.current(); }).join();
+
+		tls_context.reload(setting.tls);
+		const auto second_context = tls_context.current();
+		std::shared_ptr<boost::asio::ssl::context> other_thread_second_context;
+		std::thread([&] { other_thread_second_context = tls_context.current(); }).join();
+		pgl::server_tls_context another_tls_context;
+
+		BOOST_CHECK(first_context);
+		BOOST_CHECK(other_thread_first_context == first_context);
+		BOOST_CHECK(second_context);
+		BOOST_CHECK(second_context != first_context);
+		BOOST_CHECK(other_thread_second_context == second_context);
+		BOOST_CHECK(!another_tls_context.current());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_tls_context_cached_by_threads_is_released_after_destruction) {
+		auto setting = make_protocol_test_setting();
+		setting.tls.mode = pgl::server_tls_mode::tls;
+		const tls_test_certificate_files certificate_files;
+		setting.tls.certificate_path = certificate_files.certificate_path();
+		setting.tls.private_key_path = certificate_files.private_key_path();
+		pgl::server_tls_context another_tls_context;
+		std::weak_ptr<boost::asio::ssl::context> cached_context;
+		std::weak_ptr<boost::asio::ssl::context> other_thread_cached_context;
+		std::promise<void> destruction_promise;
+		std::promise<void> release_promise;
+		std::thread other_thread;
+		{
+			pgl::server_tls_context tls_context;
+			tls_context.reload(setting.tls);
+			cached_context = tls_context.current();
+			std::promise<void> cache_promise;
+			other_thread = std::thread([&] {
+				other_thread_cached_context = tls_context.current();
+				cache_promise.set_value();
+				destruction_promise.get_future().wait();
+				static_cast<void>(another_tls_context.current());
+				release_promise.set_value();
+			});
+			cache_promise.get_future().wait();
+		}
+
+		BOOST_CHECK(cached_context.expired());
+		BOOST_CHECK(!other_thread_cached_context.expired());
+		destruction_promise.set_value();
+		release_promise.get_future().wait();
+		BOOST_CHECK(other_thread_cached_context.expired());
+		other_thread.join();
+	}
+
+	// kTLS is offloaded only if the kernel has the tls module. Otherwise OpenSSL on the socket processes TLS as a fallback.
+	BOOST_AUTO_TEST_CASE(test_ktls_connection_authenticates_and_resumes_session) {
+		boost::asio::io_context server_io;
+		tcp::acceptor acceptor(server_io, tcp::endpoint(tcp::v4(), 0));
+		std::mutex acceptor_mutex;
+		pgl::server_data server_data;
+		auto setting = make_protocol_test_setting();
+		setting.tls.mode = pgl::server_tls_mode::tls;
+		setting.tls.enable_ktls = true;
+		const tls_test_certificate_files certificate_files;
+		setting.tls.certificate_path = certificate_files.certificate_path();
+		setting.tls.private_key_path = certificate_files.private_key_path();
+		pgl::server_tls_context tls_context;
+		tls_context.reload(setting.tls);
+		const auto invoker = pgl::message_handler_invoker_factory::make_shared_standard();
+		std::vector<std::shared_ptr<pgl::server_session>> sessions;
+		for (auto i = 0; i < 2; ++i) {
+			sessions.push_back(std::make_shared<pgl::server_session>(
+				acceptor, acceptor_mutex, boost::asio::make_strand(server_io), nullptr, tls_context, nullptr,
+				server_data, setting, invoker, std::weak_ptr<pgl::server_session_pool>()));
+			sessions.back()->start();
+		}
+		io_context_thread server_thread(server_io);
+
+		boost::asio::io_context client_io;
+		boost::asio::ssl::context client_ssl_context(boost::asio::ssl::context::tls_client);
+		client_ssl_context.set_verify_mode(boost::asio::ssl::verify_none);
+		const tcp::endpoint server_endpoint(boost::asio::ip::address_v4::loopback(), acceptor.local_endpoint().port());
+		SSL_SESSION* client_session = nullptr;
+		std::vector<pgl::authentication_reply_message> replies;
+		for (const auto* player_name : {u8"first-ktls-player", u8"second-ktls-player"}) {
+			boost::asio::ssl::stream<tcp::socket> client_stream(client_io, client_ssl_context);
+			if (client_session != nullptr) { SSL_set_session(client_stream.native_handle(), client_session); }
+			client_stream.lowest_layer().connect(server_endpoint);
+			client_stream.handshake(boost::asio::ssl::stream_base::client);
+			const pgl::authentication_request_message request{
+				pgl::api_version,
+				pgl::game_id_t(setting.authentication.game_id),
+				pgl::game_version_t(setting.authentication.game_version),
+				player_name
+			};
+			write_packed_to_stream(client_stream, pgl::request_message_header{pgl::message_type::authentication},
+				request);
+			const auto reply_header = read_packed_from_stream<pgl::reply_message_header>(client_stream);
+			BOOST_CHECK(reply_header.error_code == pgl::message_error_code::ok);
+			replies.push_back(read_packed_from_stream<pgl::authentication_reply_message>(client_stream));
+			if (client_session != nullptr) { SSL_SESSION_free(client_session); }
+			client_session = SSL_get1_session(client_stream.native_handle());
+
+			boost::system::error_code ignored_error;
+			client_stream.shutdown(ignored_error);
+			client_stream.lowest_layer().close(ignored_error);
+		}
+		SSL_SESSION_free(client_session);
+
+		BOOST_REQUIRE_EQUAL(replies.size(), 2);
+		BOOST_CHECK(replies[0].result == pgl::authentication_result::success);
+		BOOST_CHECK(replies[1].result == pgl::authentication_result::success);
+		BOOST_CHECK_EQUAL(tls_context.handshake_count(), 2);
+		BOOST_CHECK_EQUAL(tls_context.resumed_handshake_count(), 1);
+		for (const auto& session : sessions) { session->stop(); }
+		server_io.stop();
+	}
+
+	// Runs the offloaded path if the kernel has the tls module, and the user space fallback otherwise.
+	BOOST_AUTO_TEST_CASE(test_ktls_connection_receives_after_key_update_and_reads_close_notify_as_eof) {
+		boost::asio::io_context server_io;
+		tcp::acceptor acceptor(server_io, tcp::endpoint(tcp::v4(), 0));
+		auto setting = make_protocol_test_setting();
+		setting.tls.mode = pgl::server_tls_mode::tls;
+		setting.tls.enable_ktls = true;
+		const tls_test_certificate_files certificate_files;
+		setting.tls.certificate_path = certificate_files.certificate_path();
+		setting.tls.private_key_path = certificate_files.private_key_path();
+		pgl::server_tls_context tls_context;
+		tls_context.reload(setting.tls);
+		pgl::client_connection connection(server_io.get_executor(), tls_context);
+		connection.reset(pgl::server_tls_mode::tls);
+		std::string received_data;
+		boost::system::error_code last_error;
+		bool is_receive_offloaded = false;
+		auto server_future = boost::asio::co_spawn(server_io, [&]() -> boost::asio::awaitable<void> {
+			co_await acceptor.async_accept(connection.socket(), boost::asio::use_awaitable);
+			co_await connection.async_handshake();
+			is_receive_offloaded = connection.get_ktls_stream()->is_receive_offloaded();
+			for (auto i = 0; i < 2; ++i) {
+				const auto data = co_await connection.async_receive(4);
+				received_data.append(data.begin(), data.begin() + 4);
+				connection.consume_received_data(4);
+			}
+			try { co_await connection.async_receive(1); }
+			catch (const boost::system::system_error& e) { last_error = e.code(); }
+			boost::system::error_code ignored_error;
+			connection.close(ignored_error);
+		}, boost::asio::use_future);
+		io_context_thread server_thread(server_io);
+
+		boost::asio::io_context client_io;
+		boost::asio::ssl::context client_ssl_context(boost::asio::ssl::context::tls_client);
+		client_ssl_context.set_verify_mode(boost::asio::ssl::verify_none);
+		boost::asio::ssl::stream<tcp::socket> client_stream(client_io, client_ssl_context);
+		client_stream.lowest_layer().connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(),
+			acceptor.local_endpoint().port()));
+		client_stream.handshake(boost::asio::ssl::stream_base::client);
+		boost::asio::write(client_stream, boost::asio::buffer(std::string_view("abcd")));
+		// The KeyUpdate record is sent before the next application data.
+		BOOST_REQUIRE_EQUAL(SSL_key_update(client_stream.native_handle(), SSL_KEY_UPDATE_REQUESTED), 1);
+		boost::asio::write(client_stream, boost::asio::buffer(std::string_view("efgh")));
+		boost::system::error_code ignored_error;
+		client_stream.shutdown(ignored_error);
+
+		BOOST_REQUIRE(server_future.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+		server_future.get();
+		BOOST_TEST_MESSAGE("kTLS receive offloaded: " << is_receive_offloaded);
+		BOOST_CHECK_EQUAL(received_data, "abcdefgh");
+		BOOST_CHECK(last_error == boost::asio::error::eof);
+		server_io.stop();
+	}
+
+	BOOST_AUTO_TEST_CASE(test_tls_connection_handshakes_on_handshake_pool_and_authenticates) {
+		boost::asio::io_context server_io;
+		tcp::acceptor acceptor(server_io, tcp::endpoint(tcp::v4(), 0));
+		std::mutex acceptor_mutex;
+		pgl::server_data server_data;
+		auto setting = make_protocol_test_setting();
+		setting.tls.mode = pgl::server_tls_mode::tls;
+		const tls_test_certificate_files certificate_files;
+		setting.tls.certificate_path = certificate_files.certificate_path();
+		setting.tls.private_key_path = certificate_files.private_key_path();
+		pgl::server_tls_context tls_context;
+		tls_context.reload(setting.tls);
+		pgl::tls_handshake_pool handshake_pool(1, 8);
+		const auto invoker = pgl::message_handler_invoker_factory::make_shared_standard();
+		const auto session = std::make_shared<pgl::server_session>(
+			acceptor, acceptor_mutex, boost::asio::make_strand(server_io), nullptr, tls_context, &handshake_pool,
+			server_data, setting, invoker, std::weak_ptr<pgl::server_session_pool>());
+		session->start();
+		io_context_thread server_thread(server_io);
+
+		boost::asio::io_context client_io;
+		boost::asio::ssl::context client_ssl_context(boost::asio::ssl::context::tls_client);
+		client_ssl_context.set_verify_mode(boost::asio::ssl::verify_none);
+		boost::asio::ssl::stream<tcp::socket> client_stream(client_io, client_ssl_context);
+		client_stream.lowest_layer().connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(),
+			acceptor.local_endpoint().port()));
+		client_stream.handshake(boost::asio::ssl::stream_base::client);
+		const pgl::authentication_request_message request{
+			pgl::api_version,
+			pgl::game_id_t(setting.authentication.game_id),
+			pgl::game_version_t(setting.authentication.game_version),
+			u8"pool-player"
+		};
+
+		write_packed_to_stream(client_stream, pgl::request_message_header{pgl::message_type::authentication}, request);
+		const auto reply_header = read_packed_from_stream<pgl::reply_message_header>(client_stream);
+		const auto reply = read_packed_from_stream<pgl::authentication_reply_message>(client_stream);
+
+		BOOST_CHECK(reply_header.error_code == pgl::message_error_code::ok);
+		BOOST_CHECK(reply.result == pgl::authentication_result::success);
+		BOOST_CHECK_EQUAL(handshake_pool.pending_handshake_count(), 0);
+		BOOST_CHECK_EQUAL(handshake_pool.peak_pending_handshake_count(), 1);
+		BOOST_CHECK_EQUAL(tls_context.handshake_count(), 1);
+		boost::system::error_code ignored_error;
+		client_stream.shutdown(ignored_error);
+		client_stream.lowest_layer().close(ignored_error);
+		session->stop();
+		server_io.stop();
+	}
+
+	BOOST_AUTO_TEST_CASE(test_tls_handshake_over_pending_limit_is_refused_and_stalled_handshake_times_out) {
+		boost::asio::io_context server_io;
+		tcp::acceptor acceptor(server_io, tcp::endpoint(tcp::v4(), 0));
+		std::mutex acceptor_mutex;
+		pgl::server_data server_data;
+		auto setting = make_protocol_test_setting();
+		setting.tls.mode = pgl::server_tls_mode::tls;
+		const tls_test_certificate_files certificate_files;
+		setting.tls.certificate_path = certificate_files.certificate_path();
+		setting.tls.private_key_path = certificate_files.private_key_path();
+		pgl::server_tls_context tls_context;
+		tls_context.reload(setting.tls);
+		pgl::tls_handshake_pool handshake_pool(1, 1);
+		const auto invoker = pgl::message_handler_invoker_factory::make_shared_standard();
+		std::vector<std::shared_ptr<pgl::server_session>> sessions;
+		for (auto i = 0; i < 2; ++i) {
+			sessions.push_back(std::make_shared<pgl::server_session>(
+				acceptor, acceptor_mutex, boost::asio::make_strand(server_io), nullptr, tls_context, &handshake_pool,
+				server_data, setting, invoker, std::weak_ptr<pgl::server_session_pool>()));
+			sessions.back()->start();
+		}
+		io_context_thread server_thread(server_io);
+		const tcp::endpoint server_endpoint(boost::asio::ip::address_v4::loopback(), acceptor.local_endpoint().port());
+		const auto wait_pending_handshake_count = [&](const size_t count) {
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+			while (handshake_pool.pending_handshake_count() != count && std::chrono::steady_clock::now() < deadline) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+			return handshake_pool.pending_handshake_count() == count;
+		};
+
+		// A client which never sends ClientHello keeps the only pending handshake slot.
+		boost::asio::io_context client_io;
+		tcp::socket stalled_client_socket(client_io);
+		stalled_client_socket.connect(server_endpoint);
+		BOOST_REQUIRE(wait_pending_handshake_count(1));
+		boost::asio::ssl::context client_ssl_context(boost::asio::ssl::context::tls_client);
+		client_ssl_context.set_verify_mode(boost::asio::ssl::verify_none);
+		boost::asio::ssl::stream<tcp::socket> client_stream(client_io, client_ssl_context);
+		client_stream.lowest_layer().connect(server_endpoint);
+
+		BOOST_CHECK_THROW(client_stream.handshake(boost::asio::ssl::stream_base::client), boost::system::system_error);
+		BOOST_CHECK_EQUAL(handshake_pool.refused_handshake_count(), 1);
+		BOOST_CHECK(wait_pending_handshake_count(0));
+		BOOST_CHECK_EQUAL(tls_context.handshake_count(), 0);
+		for (const auto& session : sessions) { session->stop(); }
+		server_io.stop();
+	}
+
+	BOOST_AUTO_TEST_CASE(test_stopping_session_cancels_handshake_on_handshake_pool_and_closes_connection) {
+		boost::asio::io_context server_io;
+		tcp::acceptor acceptor(server_io, tcp::endpoint(tcp::v4(), 0));
+		std::mutex acceptor_mutex;
+		pgl::server_data server_data;
+		auto setting = make_protocol_test_setting();
+		setting.tls.mode = pgl::server_tls_mode::tls;
+		setting.common.time_out_seconds = 30;
+		const tls_test_certificate_files certificate_files;
+		setting.tls.certificate_path = certificate_files.certificate_path();
+		setting.tls.private_key_path = certificate_files.private_key_path();
+		pgl::server_tls_context tls_context;
+		tls_context.reload(setting.tls);
+		pgl::tls_handshake_pool handshake_pool(1, 8);
+		const auto invoker = pgl::message_handler_invoker_factory::make_shared_standard();
+		const auto session = std::make_shared<pgl::server_session>(
+			acceptor, acceptor_mutex, boost::asio::make_strand(server_io), nullptr, tls_context, &handshake_pool,
+			server_data, setting, invoker, std::weak_ptr<pgl::server_session_pool>());
+		session->start();
+		io_context_thread server_thread(server_io);
+		const auto wait_pending_handshake_count = [&](const size_t count) {
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+			while (handshake_pool.pending_handshake_count() != count && std::chrono::steady_clock::now() < deadline) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+			return handshake_pool.pending_handshake_count() == count;
+		};
+
+		// A client which never sends ClientHello keeps the handshake pending until the session is stopped.
+		boost::asio::io_context client_io;
+		tcp::socket stalled_client_socket(client_io);
+		stalled_client_socket.connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(),
+			acceptor.local_endpoint().port()));
+		BOOST_REQUIRE(wait_pending_handshake_count(1));
+		const auto stop_time = std::chrono::steady_clock::now();
+		session->stop();
+
+		std::array<uint8_t, 1> buffer{};
+		boost::system::error_code read_error;
+		stalled_client_socket.read_some(boost::asio::buffer(buffer), read_error);
+		BOOST_CHECK(read_error == boost::asio::error::eof || read_error == boost::asio::error::connection_reset);
+		BOOST_CHECK(std::chrono::steady_clock::now() - stop_time < std::chrono::seconds(5));
+		BOOST_CHECK(wait_pending_handshake_count(0));
+		server_io.stop();
+	}
+
 	BOOST_AUTO_TEST_CASE(test_authentication_request_replies_game_id_mismatch_and_disconnects) {
 		protocol_context context;
 		const pgl::authentication_request_message request{
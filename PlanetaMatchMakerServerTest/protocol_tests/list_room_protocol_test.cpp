@@ -153,6 +153,40 @@ BOOST_AUTO_TEST_SUITE(list_room_protocol_test)
 		expect_no_more_reply_data(context.client_socket);
 	}
 
+	BOOST_AUTO_TEST_CASE(test_list_room_request_sends_split_replies_in_one_write) {
+		protocol_context context;
+		for (auto i = pgl::room_id_t{1}; i <= 13; ++i) {
+			context.server_data.get_room_data_container().add_or_update(
+				make_room(i, {u8"host", static_cast<pgl::player_tag_t>(i)}));
+		}
+		// A name filter makes the reply not cacheable, so each reply body is packed separately.
+		const pgl::list_room_request_message request{
+			0,
+			13,
+			pgl::room_data_sort_kind::create_datetime_ascending,
+			pgl::room_search_target_flag::public_room | pgl::room_search_target_flag::open_room,
+			{u8"host", pgl::player_full_name::not_assigned_tag}
+		};
+		const auto write_count_before = context.server_connection.get_socket_operation_count().write_count;
+		protocol_handler_run handler(context, pgl::message_type::list_room);
+
+		write_packed(context.client_socket, pgl::request_message_header{pgl::message_type::list_room}, request);
+		std::vector<pgl::list_room_reply_message> replies;
+		for (auto i = 0; i < 3; ++i) {
+			const auto reply_header = read_packed<pgl::reply_message_header>(context.client_socket);
+			BOOST_CHECK(reply_header.error_code == pgl::message_error_code::ok);
+			replies.push_back(read_packed<pgl::list_room_reply_message>(context.client_socket));
+		}
+		const auto exception = handler.wait();
+
+		BOOST_CHECK(!exception);
+		BOOST_CHECK_EQUAL(replies[0].room_info_list[0].room_id, 1);
+		BOOST_CHECK_EQUAL(replies[1].room_info_list[0].room_id, 7);
+		BOOST_CHECK_EQUAL(replies[2].room_info_list[0].room_id, 13);
+		BOOST_CHECK_EQUAL(context.server_connection.get_socket_operation_count().write_count - write_count_before, 1);
+		expect_no_more_reply_data(context.client_socket);
+	}
+
 	BOOST_AUTO_TEST_CASE(test_list_room_request_filters_by_room_status_name_and_tag) {
 		protocol_context context;
 		context.server_data.get_room_data_container().add_or_update(make_room(1, {u8"alice", 7},
@@ -205,4 +239,42 @@ BOOST_AUTO_TEST_SUITE(list_room_protocol_test)
 		expect_no_more_reply_data(context.client_socket);
 	}
 
+	BOOST_AUTO_TEST_CASE(test_list_room_request_replies_from_cache_until_rooms_change) {
+		protocol_context context;
+		auto& room_data_container = context.server_data.get_room_data_container();
+		room_data_container.add_or_update(make_room(1, {u8"alice", 1}));
+		const pgl::list_room_request_message request{
+			0,
+			10,
+			pgl::room_data_sort_kind::name_ascending,
+			pgl::room_search_target_flag::public_room | pgl::room_search_target_flag::open_room,
+			{}
+		};
+		const auto request_list_room = [&] {
+			protocol_handler_run handler(context, pgl::message_type::list_room);
+			write_packed(context.client_socket, pgl::request_message_header{pgl::message_type::list_room}, request);
+			const auto reply_header = read_packed<pgl::reply_message_header>(context.client_socket);
+			const auto reply = read_packed<pgl::list_room_reply_message>(context.client_socket);
+			const auto exception = handler.wait();
+			BOOST_CHECK(!exception);
+			BOOST_CHECK(reply_header.error_code == pgl::message_error_code::ok);
+			return reply;
+		};
+
+		const auto first_reply = request_list_room();
+		const auto cached_reply = request_list_room();
+		room_data_container.add_or_update(make_room(2, {u8"bob", 1}));
+		const auto updated_reply = request_list_room();
+
+		const auto& reply_cache = context.server_data.get_list_room_reply_cache();
+		BOOST_CHECK_EQUAL(reply_cache.hit_count(), 1);
+		BOOST_CHECK_EQUAL(reply_cache.miss_count(), 2);
+		BOOST_CHECK_EQUAL(first_reply.matched_room_count, 1);
+		BOOST_CHECK_EQUAL(cached_reply.matched_room_count, 1);
+		BOOST_CHECK_EQUAL(cached_reply.room_info_list[0].room_id, 1);
+		BOOST_CHECK_EQUAL(updated_reply.matched_room_count, 2);
+		BOOST_CHECK_EQUAL(updated_reply.reply_room_count, 2);
+		expect_no_more_reply_data(context.client_socket);
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -52,4 +52,77 @@ BOOST_AUTO_TEST_SUITE(message_flow_protocol_test)
 		expect_no_more_reply_data(context.client_socket);
 	}
 
+	BOOST_AUTO_TEST_CASE(test_pipelined_requests_are_handled_in_order) {
+		protocol_context context;
+		context.server_data.get_room_data_container().add_or_update(make_room(1, {u8"alice", 1}));
+		context.server_data.get_room_data_container().add_or_update(make_room(2, {u8"bob", 1}));
+		const auto make_list_room_request = [](const uint16_t start_index) {
+			return pgl::list_room_request_message{
+				start_index,
+				1,
+				pgl::room_data_sort_kind::name_ascending,
+				pgl::room_search_target_flag::public_room | pgl::room_search_target_flag::open_room,
+				{}
+			};
+		};
+		protocol_handler_run handler(context, std::nullopt, 3);
+
+		write_packed(context.client_socket,
+			pgl::request_message_header{pgl::message_type::list_room}, make_list_room_request(0),
+			pgl::request_message_header{pgl::message_type::keep_alive}, pgl::keep_alive_notice_message{},
+			pgl::request_message_header{pgl::message_type::list_room}, make_list_room_request(1));
+		const auto exception = handler.wait();
+		const auto first_reply_header = read_packed<pgl::reply_message_header>(context.client_socket);
+		const auto first_reply = read_packed<pgl::list_room_reply_message>(context.client_socket);
+		const auto second_reply_header = read_packed<pgl::reply_message_header>(context.client_socket);
+		const auto second_reply = read_packed<pgl::list_room_reply_message>(context.client_socket);
+
+		BOOST_CHECK(!exception);
+		BOOST_CHECK(first_reply_header.error_code == pgl::message_error_code::ok);
+		BOOST_CHECK_EQUAL(first_reply.room_info_list[0].room_id, 1);
+		BOOST_CHECK(second_reply_header.error_code == pgl::message_error_code::ok);
+		BOOST_CHECK_EQUAL(second_reply.room_info_list[0].room_id, 2);
+		BOOST_CHECK_EQUAL(context.server_connection.queued_write_size(), 0);
+		expect_no_more_reply_data(context.client_socket);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_pipelined_reply_is_delivered_before_disconnect_for_invalid_message_type) {
+		protocol_context context;
+		context.server_data.get_room_data_container().add_or_update(make_room(1, {u8"alice", 1}));
+		const pgl::list_room_request_message request{
+			0,
+			1,
+			pgl::room_data_sort_kind::name_ascending,
+			pgl::room_search_target_flag::public_room | pgl::room_search_target_flag::open_room,
+			{}
+		};
+		protocol_handler_run handler(context, std::nullopt, 2);
+
+		write_packed(context.client_socket, pgl::request_message_header{pgl::message_type::list_room}, request,
+			pgl::request_message_header{static_cast<pgl::message_type>(200)});
+		const auto exception = handler.wait();
+		const auto reply_header = read_packed<pgl::reply_message_header>(context.client_socket);
+		const auto reply = read_packed<pgl::list_room_reply_message>(context.client_socket);
+
+		BOOST_CHECK(is_intended_disconnect(exception));
+		BOOST_CHECK(reply_header.error_code == pgl::message_error_code::ok);
+		BOOST_CHECK_EQUAL(reply.room_info_list[0].room_id, 1);
+		expect_no_more_reply_data(context.client_socket);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_receive_times_out_by_deadline_of_timer_wheel) {
+		protocol_context context(true);
+		context.setting.common.time_out_seconds = 1;
+		const auto start_time = std::chrono::steady_clock::now();
+		protocol_handler_run handler(context);
+
+		const auto exception = handler.wait();
+
+		BOOST_REQUIRE(exception);
+		BOOST_CHECK_THROW(std::rethrow_exception(exception), pgl::server_session_error);
+		BOOST_CHECK(std::chrono::steady_clock::now() - start_time >= std::chrono::seconds(1));
+		BOOST_CHECK(!context.server_connection.deadline().is_armed());
+		BOOST_CHECK_EQUAL(context.deadline_wheel->armed_count(), 0);
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
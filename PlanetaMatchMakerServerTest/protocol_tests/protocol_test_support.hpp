@@ -13,9 +13,9 @@
 #include <vector>
 
 #include <boost/asio.hpp>
-#include <boost/asio/spawn.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "../../PlanetaMatchMakerServer/source/async/timer_wheel.hpp"
 #include "../../PlanetaMatchMakerServer/source/message/message_handler_invoker.hpp"
 #include "../../PlanetaMatchMakerServer/source/message/message_handler_invoker_factory.hpp"
 #include "../../PlanetaMatchMakerServer/source/message/message_handle_parameter.hpp"
@@ -117,16 +117,21 @@ namespace pgl::test {
 		tcp::socket client_socket;
 		boost::asio::strand<boost::asio::any_io_executor> strand;
 		pgl::server_tls_context tls_context;
+		std::shared_ptr<pgl::timer_wheel> deadline_wheel;
 		pgl::client_connection server_connection;
 		pgl::server_data server_data;
 		pgl::server_setting setting;
 		pgl::session_data session_data;
 
-		protocol_context():
+		// If use_deadline_wheel is true, deadlines of the server connection are held by a timer wheel.
+		explicit protocol_context(const bool use_deadline_wheel = false):
 			acceptor(io, tcp::endpoint(tcp::v4(), 0)),
 			client_socket(io),
 			strand(boost::asio::make_strand(io)),
-			server_connection(strand, tls_context),
+			deadline_wheel(use_deadline_wheel
+				? std::make_shared<pgl::timer_wheel>(io.get_executor(), std::chrono::milliseconds(10))
+				: nullptr),
+			server_connection(strand, tls_context, deadline_wheel),
 			setting(make_protocol_test_setting()) {
 			server_connection.reset(pgl::server_tls_mode::plain);
 			client_socket.connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(),
@@ -145,32 +150,34 @@ namespace pgl::test {
 		protocol_handler_run(protocol_context& context, const pgl::message_type message_type):
 			protocol_handler_run(context, std::optional(message_type)) {}
 
-		protocol_handler_run(protocol_context& context, const std::optional<pgl::message_type> message_type):
+		protocol_handler_run(protocol_context& context, const std::optional<pgl::message_type> message_type,
+			const size_t message_count = 1):
 			context_(context),
 			promise_(std::make_shared<std::promise<std::exception_ptr>>()),
 			future_(promise_->get_future()) {
 			const auto invoker = pgl::message_handler_invoker_factory::make_shared_standard();
 			context_.io.restart();
 			work_guard_.emplace(context_.io.get_executor());
-			boost::asio::spawn(context_.strand, [this, invoker, message_type](
-				boost::asio::yield_context yield) {
+			const auto run = [this, invoker, message_type, message_count]() -> boost::asio::awaitable<void> {
 				std::exception_ptr exception;
 				try {
 					auto param = std::make_shared<pgl::message_handle_parameter>(pgl::message_handle_parameter{
 						context_.server_connection,
 						context_.server_data,
-						yield,
 						std::chrono::seconds(context_.setting.common.time_out_seconds),
 						context_.session_data,
 						context_.setting
 					});
-					if (message_type.has_value()) { invoker->handle_specific_message(*message_type, param); }
-					else { invoker->handle_message(param); }
+					for (size_t i = 0; i < message_count; ++i) {
+						if (message_type.has_value()) { co_await invoker->handle_specific_message(*message_type, param); }
+						else { co_await invoker->handle_message(param); }
+					}
 				}
 				catch (...) { exception = std::current_exception(); }
 
 				promise_->set_value(exception);
-			}, boost::asio::detached);
+			};
+			boost::asio::co_spawn(context_.strand, run, boost::asio::detached);
 			thread_ = std::thread([this] { context_.io.run(); });
 		}
 
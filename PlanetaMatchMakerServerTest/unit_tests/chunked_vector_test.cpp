@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/data/chunked_vector.hpp"
+
+using namespace pgl;
+
+namespace {
+	using test_chunked_vector = chunked_vector<int, 4>;
+
+	test_chunked_vector make_sorted_vector(const int size) {
+		test_chunked_vector vector;
+		for (auto i = 0; i < size; ++i) { vector.insert(vector.end(), i * 10); }
+		return vector;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(chunked_vector_test)
+
+	BOOST_AUTO_TEST_CASE(test_insert_keeps_values_in_order_over_chunks) {
+		// set up
+		auto vector = make_sorted_vector(10);
+
+		// exercise
+		vector.insert(vector.lower_bound(35), 35);
+		vector.insert(vector.begin(), -10);
+
+		// verify
+		const std::vector expected{-10, 0, 10, 20, 30, 35, 40, 50, 60, 70, 80, 90};
+		BOOST_CHECK_EQUAL(vector.size(), expected.size());
+		BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), expected.begin(), expected.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_erase_removes_values_and_keeps_order) {
+		// set up
+		auto vector = make_sorted_vector(10);
+
+		// exercise
+		for (auto value = 0; value < 100; value += 20) { vector.erase(vector.lower_bound(value)); }
+
+		// verify
+		const std::vector expected{10, 30, 50, 70, 90};
+		BOOST_CHECK_EQUAL(vector.size(), expected.size());
+		BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), expected.begin(), expected.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_erase_all_values_makes_empty_vector) {
+		// set up
+		auto vector = make_sorted_vector(10);
+
+		// exercise
+		while (!vector.empty()) { vector.erase(vector.begin()); }
+
+		// verify
+		BOOST_CHECK_EQUAL(vector.size(), 0);
+		BOOST_CHECK(vector.begin() == vector.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_lower_bound_uses_compare_and_projection) {
+		// set up
+		auto vector = make_sorted_vector(10);
+
+		// exercise
+		const auto it = vector.lower_bound(-45, std::ranges::greater(), [](const int value) { return -value; });
+
+		// verify
+		BOOST_REQUIRE(it != vector.end());
+		BOOST_CHECK_EQUAL(*it, 50);
+		BOOST_CHECK(vector.lower_bound(100) == vector.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_modification_does_not_change_copy) {
+		// set up
+		auto vector = make_sorted_vector(10);
+		const auto copy = vector;
+
+		// exercise
+		vector.replace(vector.lower_bound(50), 55);
+		vector.erase(vector.begin());
+		vector.insert(vector.end(), 100);
+
+		// verify
+		const std::vector expected{0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+		BOOST_CHECK_EQUAL_COLLECTIONS(copy.begin(), copy.end(), expected.begin(), expected.end());
+		const std::vector modified_expected{10, 20, 30, 40, 55, 60, 70, 80, 90, 100};
+		BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), modified_expected.begin(), modified_expected.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_iterator_walks_backward) {
+		// set up
+		const auto vector = make_sorted_vector(10);
+
+		// exercise
+		std::vector<int> values;
+		std::ranges::copy(std::make_reverse_iterator(vector.end()), std::make_reverse_iterator(vector.begin()),
+			std::back_inserter(values));
+
+		// verify
+		const std::vector expected{90, 80, 70, 60, 50, 40, 30, 20, 10, 0};
+		BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), expected.begin(), expected.end());
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
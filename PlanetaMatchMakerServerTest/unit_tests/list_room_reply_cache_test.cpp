@@ -0,0 +1,91 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/server/list_room_reply_cache.hpp"
+
+using namespace pgl;
+
+namespace {
+	const list_room_reply_cache_key default_key{
+		room_data_sort_kind::name_ascending,
+		room_search_target_flag::public_room | room_search_target_flag::open_room,
+		0,
+		6
+	};
+
+	list_room_reply_cache::packed_reply_type make_packed_reply(const uint8_t value) {
+		return std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{value});
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(list_room_reply_cache_test)
+
+	BOOST_AUTO_TEST_CASE(test_try_get_returns_reply_of_same_version_and_key) {
+		// set up
+		auto cache = list_room_reply_cache(4);
+		const auto packed_reply = make_packed_reply(1);
+		cache.add(1, default_key, packed_reply);
+
+		// exercise
+		const auto result = cache.try_get(1, default_key);
+
+		// verify
+		BOOST_CHECK_EQUAL(result, packed_reply);
+		BOOST_CHECK_EQUAL(cache.hit_count(), 1);
+		BOOST_CHECK_EQUAL(cache.miss_count(), 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_try_get_misses_other_version_or_key) {
+		// set up
+		auto cache = list_room_reply_cache(4);
+		auto other_key = default_key;
+		other_key.start_index = 6;
+		cache.add(1, default_key, make_packed_reply(1));
+
+		// exercise
+		const auto other_version_result = cache.try_get(2, default_key);
+		const auto other_key_result = cache.try_get(1, other_key);
+
+		// verify
+		BOOST_CHECK(!other_version_result);
+		BOOST_CHECK(!other_key_result);
+		BOOST_CHECK_EQUAL(cache.hit_count(), 0);
+		BOOST_CHECK_EQUAL(cache.miss_count(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_add_drops_replies_of_older_version) {
+		// set up
+		auto cache = list_room_reply_cache(4);
+		cache.add(1, default_key, make_packed_reply(1));
+
+		// exercise
+		cache.add(2, default_key, make_packed_reply(2));
+		cache.add(1, default_key, make_packed_reply(3));
+
+		// verify
+		BOOST_CHECK(!cache.try_get(1, default_key));
+		const auto result = cache.try_get(2, default_key);
+		BOOST_REQUIRE(result);
+		BOOST_CHECK_EQUAL(result->front(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_add_ignores_reply_over_capacity) {
+		// set up
+		auto cache = list_room_reply_cache(1);
+		auto other_key = default_key;
+		other_key.count = 1;
+		cache.add(1, default_key, make_packed_reply(1));
+
+		// exercise
+		cache.add(1, other_key, make_packed_reply(2));
+
+		// verify
+		BOOST_CHECK(cache.try_get(1, default_key));
+		BOOST_CHECK(!cache.try_get(1, other_key));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_is_enabled_returns_false_for_zero_capacity) {
+		BOOST_CHECK(!list_room_reply_cache(0).is_enabled());
+		BOOST_CHECK(list_room_reply_cache(1).is_enabled());
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,7 @@
 
 #include "../../PlanetaMatchMakerServer/source/message/message_handler_invoker.hpp"
 #include "../../PlanetaMatchMakerServer/source/message/message_handler_invoker_factory.hpp"
+#include "../../PlanetaMatchMakerServer/source/message/message_handlers/keep_alive_notice_message_handler.hpp"
 
 BOOST_AUTO_TEST_SUITE(message_handler_invoker_factory_test)
 	BOOST_AUTO_TEST_CASE(test_make_shared_standard_returns_invoker) {
@@ -16,4 +17,19 @@ BOOST_AUTO_TEST_SUITE(message_handler_invoker_factory_test)
 		BOOST_CHECK(invoker != nullptr);
 	}
 
+	BOOST_AUTO_TEST_CASE(test_set_handler_sets_shared_handler_only_for_message_type) {
+		constexpr auto handler_table = [] {
+			pgl::message_handler_invoker::handler_table_type table{};
+			pgl::message_handler_invoker::set_handler<pgl::message_type::keep_alive,
+				pgl::keep_alive_notice_message_handler>(table);
+			return table;
+		}();
+
+		constexpr auto index = static_cast<size_t>(pgl::message_type::keep_alive);
+		BOOST_CHECK(handler_table[index] == &pgl::shared_message_handler<pgl::keep_alive_notice_message_handler>);
+		for (auto i = 0u; i < handler_table.size(); ++i) {
+			if (i != index) { BOOST_CHECK(handler_table[i] == nullptr); }
+		}
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
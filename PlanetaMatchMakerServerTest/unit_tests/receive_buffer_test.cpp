@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/network/receive_buffer.hpp"
+
+using namespace pgl;
+
+namespace {
+	void write(receive_buffer& buffer, const std::vector<uint8_t>& bytes) {
+		const auto space = buffer.prepare(bytes.size());
+		std::copy(bytes.begin(), bytes.end(), space.begin());
+		buffer.commit(bytes.size());
+	}
+
+	std::vector<uint8_t> to_vector(const std::span<const uint8_t> data) { return {data.begin(), data.end()}; }
+}
+
+BOOST_AUTO_TEST_SUITE(receive_buffer_test)
+
+	BOOST_AUTO_TEST_CASE(test_constructor_throws_when_capacity_is_zero) {
+		// exercise & verify
+		BOOST_CHECK_THROW(receive_buffer(0), std::invalid_argument);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_prepare_returns_all_free_space) {
+		// set up
+		receive_buffer buffer(8);
+
+		// exercise
+		const auto space = buffer.prepare(1);
+
+		// verify
+		BOOST_CHECK_EQUAL(space.size(), 8);
+		BOOST_CHECK_EQUAL(buffer.size(), 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_commit_makes_written_bytes_readable) {
+		// set up
+		receive_buffer buffer(8);
+
+		// exercise
+		write(buffer, {1, 2, 3});
+
+		// verify
+		BOOST_CHECK(to_vector(buffer.data()) == std::vector<uint8_t>({1, 2, 3}));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_consume_removes_bytes_from_front) {
+		// set up
+		receive_buffer buffer(8);
+		write(buffer, {1, 2, 3});
+
+		// exercise
+		buffer.consume(2);
+
+		// verify
+		BOOST_CHECK(to_vector(buffer.data()) == std::vector<uint8_t>({3}));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_prepare_moves_remaining_bytes_to_front_when_space_is_short) {
+		// set up
+		receive_buffer buffer(4);
+		write(buffer, {1, 2, 3});
+		buffer.consume(2);
+
+		// exercise
+		const auto space = buffer.prepare(3);
+
+		// verify
+		BOOST_CHECK_EQUAL(space.size(), 3);
+		BOOST_CHECK(to_vector(buffer.data()) == std::vector<uint8_t>({3}));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_consume_all_bytes_rewinds_to_front) {
+		// set up
+		receive_buffer buffer(4);
+		write(buffer, {1, 2, 3});
+
+		// exercise
+		buffer.consume(3);
+		const auto space = buffer.prepare(1);
+
+		// verify
+		BOOST_CHECK_EQUAL(space.size(), 4);
+		BOOST_CHECK_EQUAL(buffer.size(), 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_prepare_throws_when_space_exceeds_capacity) {
+		// set up
+		receive_buffer buffer(4);
+		write(buffer, {1, 2});
+
+		// exercise & verify
+		BOOST_CHECK_THROW(static_cast<void>(buffer.prepare(3)), std::length_error);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_commit_and_consume_throw_when_size_is_out_of_range) {
+		// set up
+		receive_buffer buffer(4);
+		write(buffer, {1, 2});
+
+		// exercise & verify
+		BOOST_CHECK_THROW(buffer.commit(3), std::out_of_range);
+		BOOST_CHECK_THROW(buffer.consume(3), std::out_of_range);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_clear_removes_all_bytes) {
+		// set up
+		receive_buffer buffer(4);
+		write(buffer, {1, 2});
+
+		// exercise
+		buffer.clear();
+
+		// verify
+		BOOST_CHECK_EQUAL(buffer.size(), 0);
+		BOOST_CHECK_EQUAL(buffer.prepare(4).size(), 4);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,3 +1,4 @@
+#include <array>
 #include <atomic>
 #include <thread>
 #include <vector>
@@ -178,4 +179,353 @@ BOOST_AUTO_TEST_SUITE(room_data_container_test)
 		BOOST_CHECK_EQUAL(result.data.front().room_id, 1);
 	}
 
+	BOOST_AUTO_TEST_CASE(test_search_with_total_sorts_results_of_all_shards) {
+		// set up
+		auto container = room_data_container(4);
+		for (auto room_id = room_id_t{1}; room_id <= 8; ++room_id) {
+			container.add_or_update(make_room(room_id, static_cast<player_tag_t>(9 - room_id), 4, 1));
+		}
+
+		// exercise
+		const auto result = container.search_with_total(room_data_sort_kind::name_ascending,
+			room_search_target_flag::public_room | room_search_target_flag::open_room, {});
+
+		// verify
+		BOOST_CHECK_EQUAL(result.total_room_count, 8);
+		BOOST_REQUIRE_EQUAL(result.data.size(), 8);
+		for (auto i = 0u; i < result.data.size(); ++i) {
+			BOOST_CHECK_EQUAL(result.data[i].room_id, 8 - i);
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(test_add_or_update_rejects_host_player_full_name_duplicated_in_other_shard) {
+		// set up
+		auto container = room_data_container(4);
+		container.add_or_update(make_room(1, 1, 4, 1));
+
+		// exercise and verify
+		BOOST_CHECK_THROW(container.add_or_update(make_room(2, 1, 4, 1)), unique_variable_duplication_error);
+		BOOST_CHECK(!container.contains(2));
+		BOOST_CHECK_EQUAL(container.size(), 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_add_or_update_releases_previous_host_player_full_name) {
+		// set up
+		auto container = room_data_container(4);
+		container.add_or_update(make_room(1, 1, 4, 1));
+
+		// exercise
+		container.add_or_update(make_room(1, 2, 4, 1));
+
+		// verify
+		BOOST_CHECK_EQUAL(container.get(1).host_player_full_name.tag, 2);
+		BOOST_CHECK_NO_THROW(container.add_or_update(make_room(2, 1, 4, 1)));
+		BOOST_CHECK_THROW(container.add_or_update(make_room(3, 2, 4, 1)), unique_variable_duplication_error);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_assign_id_and_add_assigns_room_ids_over_many_shards) {
+		// set up
+		auto container = room_data_container(1000);
+		std::vector<room_id_t> room_ids;
+
+		// exercise
+		for (auto host_tag = player_tag_t{1}; host_tag <= 100; ++host_tag) {
+			room_ids.push_back(container.assign_id_and_add(make_room(0, host_tag, 4, 1)));
+		}
+
+		// verify
+		BOOST_CHECK_EQUAL(container.size(), 100);
+		for (auto i = 0u; i < room_ids.size(); ++i) {
+			BOOST_REQUIRE(container.contains(room_ids[i]));
+			BOOST_CHECK_EQUAL(container.get(room_ids[i]).host_player_full_name.tag, i + 1);
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(test_try_remove_releases_host_player_full_name) {
+		// set up
+		auto container = room_data_container(4);
+		container.add_or_update(make_room(1, 1, 4, 1));
+
+		// exercise
+		const auto is_removed = container.try_remove(1);
+		const auto room_id = container.assign_id_and_add(make_room(0, 1, 4, 1));
+
+		// verify
+		BOOST_CHECK(is_removed);
+		BOOST_CHECK(container.contains(room_id));
+		BOOST_CHECK_EQUAL(container.size(), 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_concurrent_try_assign_id_and_add_over_shards_does_not_exceed_limit) {
+		// set up
+		auto container = room_data_container(4);
+		constexpr auto max_room_count = size_t{10};
+		constexpr auto thread_count = 8u;
+		constexpr auto try_count_per_thread = 4u;
+		std::atomic<bool> can_start = false;
+		std::atomic<unsigned> added_count = 0;
+		std::vector<std::thread> threads;
+		threads.reserve(thread_count);
+
+		// exercise
+		for (auto thread_index = 0u; thread_index < thread_count; ++thread_index) {
+			threads.emplace_back([&, thread_index] {
+				while (!can_start.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+
+				for (auto i = 0u; i < try_count_per_thread; ++i) {
+					const auto host_tag = static_cast<player_tag_t>(thread_index * try_count_per_thread + i + 1);
+					if (container.try_assign_id_and_add(make_room(0, host_tag, 4, 1), max_room_count).has_value()) {
+						++added_count;
+					}
+				}
+			});
+		}
+
+		can_start.store(true, std::memory_order_release);
+		for (auto& thread : threads) { thread.join(); }
+
+		// verify
+		BOOST_CHECK_EQUAL(added_count.load(), max_room_count);
+		BOOST_CHECK_EQUAL(container.size(), max_room_count);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_slot_map_storage_assigns_room_ids_over_shards) {
+		// set up
+		auto container = room_data_container(4, room_storage_kind::slot_map);
+		std::vector<room_id_t> room_ids;
+
+		// exercise
+		for (auto host_tag = player_tag_t{1}; host_tag <= 8; ++host_tag) {
+			room_ids.push_back(container.assign_id_and_add(make_room(0, host_tag, 4, 1)));
+		}
+
+		// verify
+		BOOST_CHECK_EQUAL(container.size(), 8);
+		for (auto i = 0u; i < room_ids.size(); ++i) {
+			BOOST_REQUIRE(container.contains(room_ids[i]));
+			BOOST_CHECK_EQUAL(container.get(room_ids[i]).host_player_full_name.tag, i + 1);
+		}
+
+		const auto result = container.search_with_total(room_data_sort_kind::name_ascending,
+			room_search_target_flag::public_room | room_search_target_flag::open_room, {});
+		BOOST_CHECK_EQUAL(result.matched_room_count, 8);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_slot_map_storage_does_not_find_removed_room_by_reused_slot) {
+		// set up
+		auto container = room_data_container(1, room_storage_kind::slot_map);
+		const auto old_room_id = container.assign_id_and_add(make_room(0, 1, 4, 1));
+		container.try_remove(old_room_id);
+
+		// exercise
+		const auto new_room_id = container.assign_id_and_add(make_room(0, 2, 4, 1));
+
+		// verify
+		BOOST_CHECK_NE(new_room_id, old_room_id);
+		BOOST_CHECK(!container.contains(old_room_id));
+		BOOST_CHECK(!container.try_get(old_room_id).has_value());
+		BOOST_CHECK(!container.try_remove(old_room_id));
+		BOOST_CHECK(container.contains(new_room_id));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_slot_map_storage_rejects_room_id_not_issued) {
+		// set up
+		auto container = room_data_container(4, room_storage_kind::slot_map);
+		const auto room_id = container.assign_id_and_add(make_room(0, 1, 4, 1));
+
+		// exercise and verify
+		BOOST_CHECK_THROW(container.add_or_update(make_room(room_id + 1, 2, 4, 1)), std::invalid_argument);
+		BOOST_CHECK_EQUAL(container.size(), 1);
+		// The host player name of the rejected room is not left reserved.
+		BOOST_CHECK_NO_THROW(container.assign_id_and_add(make_room(0, 2, 4, 1)));
+		BOOST_CHECK(!container.add_or_update(make_room(room_id, 1, 4, 2)));
+		BOOST_CHECK_EQUAL(container.get(room_id).current_player_count, 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_search_range_with_total_returns_page_in_order_over_shards) {
+		// set up
+		auto container = room_data_container(4);
+		for (auto room_id = room_id_t{1}; room_id <= 8; ++room_id) {
+			const auto setting_flags = room_id % 2 == 0 ? public_open_room : room_setting_flag::public_room;
+			container.add_or_update(make_room(room_id, static_cast<player_tag_t>(room_id), 4, 1, setting_flags));
+		}
+
+		// exercise
+		const auto result = container.search_range_with_total(1, 2, room_data_sort_kind::name_descending,
+			room_search_target_flag::public_room | room_search_target_flag::open_room, {});
+
+		// verify
+		BOOST_CHECK_EQUAL(result.total_room_count, 8);
+		BOOST_CHECK_EQUAL(result.matched_room_count, 4);
+		BOOST_REQUIRE_EQUAL(result.data.size(), 2);
+		BOOST_CHECK_EQUAL(result.data[0].room_id, 6);
+		BOOST_CHECK_EQUAL(result.data[1].room_id, 4);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_search_range_with_total_puts_exact_search_name_first) {
+		// set up
+		auto container = room_data_container(4);
+		auto partial_match_room = make_room(1, 1, 4, 1);
+		partial_match_room.host_player_full_name.name = u8"hostess";
+		container.add_or_update(partial_match_room);
+		container.add_or_update(make_room(2, 2, 4, 1));
+
+		// exercise
+		const auto result = container.search_range_with_total(0, 2, room_data_sort_kind::name_descending,
+			room_search_target_flag::public_room | room_search_target_flag::open_room, {u8"host", 0});
+
+		// verify
+		BOOST_CHECK_EQUAL(result.matched_room_count, 2);
+		BOOST_REQUIRE_EQUAL(result.data.size(), 2);
+		BOOST_CHECK_EQUAL(result.data[0].room_id, 2);
+		BOOST_CHECK_EQUAL(result.data[1].room_id, 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_search_range_with_total_follows_open_room_toggled_by_host) {
+		// set up
+		auto container = room_data_container();
+		container.add_or_update(make_room(1, 1, 4, 1));
+		container.add_or_update(make_room(2, 2, 4, 1));
+
+		// exercise
+		container.try_update_with_host_reported_current_player_count(1, false, 0, [](auto& room) {
+			room.setting_flags = room_setting_flag::public_room;
+		});
+		const auto open_result = container.search_range_with_total(0, 6, room_data_sort_kind::name_ascending,
+			room_search_target_flag::public_room | room_search_target_flag::open_room, {});
+		const auto closed_result = container.search_range_with_total(0, 6, room_data_sort_kind::name_ascending,
+			room_search_target_flag::public_room | room_search_target_flag::closed_room, {});
+
+		// verify
+		BOOST_CHECK_EQUAL(open_result.matched_room_count, 1);
+		BOOST_REQUIRE_EQUAL(open_result.data.size(), 1);
+		BOOST_CHECK_EQUAL(open_result.data.front().room_id, 2);
+		BOOST_CHECK_EQUAL(closed_result.matched_room_count, 1);
+		BOOST_REQUIRE_EQUAL(closed_result.data.size(), 1);
+		BOOST_CHECK_EQUAL(closed_result.data.front().room_id, 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_search_range_with_total_counts_only_rooms_matching_search_name_in_partitions) {
+		// set up
+		auto container = room_data_container(2);
+		container.add_or_update(make_room(1, 1, 4, 1));
+		container.add_or_update(make_room(2, 2, 4, 1));
+		container.add_or_update(make_room(3, 3, 4, 1, room_setting_flag::public_room));
+
+		// exercise
+		const auto result = container.search_range_with_total(0, 6, room_data_sort_kind::name_ascending,
+			room_search_target_flag::public_room | room_search_target_flag::open_room, {u8"host", 2});
+
+		// verify
+		BOOST_CHECK_EQUAL(result.total_room_count, 3);
+		BOOST_CHECK_EQUAL(result.matched_room_count, 1);
+		BOOST_REQUIRE_EQUAL(result.data.size(), 1);
+		BOOST_CHECK_EQUAL(result.data.front().room_id, 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_search_range_with_total_finds_name_substring_over_shards) {
+		// set up
+		auto container = room_data_container(4);
+		const std::array<const char8_t*, 5> host_names{u8"alice", u8"malice", u8"bob", u8"alicia", u8"lice"};
+		for (auto i = 0u; i < host_names.size(); ++i) {
+			auto room = make_room(static_cast<room_id_t>(i + 1), 1, 4, 1);
+			room.host_player_full_name.name = host_names[i];
+			container.add_or_update(room);
+		}
+
+		// exercise
+		const auto result = container.search_range_with_total(1, 6, room_data_sort_kind::name_ascending,
+			room_search_target_flag::public_room | room_search_target_flag::open_room, {u8"lice", 0});
+
+		// verify
+		BOOST_CHECK_EQUAL(result.matched_room_count, 3);
+		BOOST_REQUIRE_EQUAL(result.data.size(), 2);
+		BOOST_CHECK_EQUAL(result.data[0].room_id, 1);
+		BOOST_CHECK_EQUAL(result.data[1].room_id, 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_search_range_with_total_rejects_invalid_sort_kind_without_rooms) {
+		// set up
+		const auto container = room_data_container();
+
+		// exercise and verify
+		BOOST_CHECK_THROW(container.search_range_with_total(0, 1, static_cast<room_data_sort_kind>(255),
+			room_search_target_flag::public_room, {}), std::out_of_range);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_version_is_counted_up_by_changes_of_rooms) {
+		// set up
+		auto container = room_data_container(2);
+		const auto initial_version = container.version();
+
+		// exercise and verify
+		const auto room_id = container.assign_id_and_add(make_room(0, 1, 4, 1));
+		const auto added_version = container.version();
+		BOOST_CHECK_GT(added_version, initial_version);
+
+		container.try_reserve_player_for_join(room_id, game_host_connection_establish_mode::builtin, {});
+		const auto reserved_version = container.version();
+		BOOST_CHECK_GT(reserved_version, added_version);
+
+		container.try_reserve_player_for_join(room_id, game_host_connection_establish_mode::steam, {});
+		BOOST_CHECK_EQUAL(container.version(), reserved_version);
+
+		container.try_remove(room_id);
+		BOOST_CHECK_GT(container.version(), reserved_version);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_search_with_total_reflects_room_updates) {
+		// set up
+		auto container = room_data_container(4);
+		container.add_or_update(make_room(1, 1, 4, 1));
+		container.add_or_update(make_room(2, 2, 4, 1));
+
+		// exercise
+		container.try_update_with_host_reported_current_player_count(1, false, 0, [](auto& room) {
+			room.setting_flags = room_setting_flag::public_room;
+		});
+		container.try_remove(2);
+		const auto result = container.search_with_total(room_data_sort_kind::name_ascending,
+			room_search_target_flag::public_room | room_search_target_flag::open_room, {});
+
+		// verify
+		BOOST_CHECK_EQUAL(result.total_room_count, 1);
+		BOOST_CHECK(result.data.empty());
+		BOOST_CHECK_EQUAL(container.size(), 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_concurrent_search_with_total_while_updating_rooms) {
+		// set up
+		auto container = room_data_container(4);
+		constexpr auto room_count = 8u;
+		constexpr auto update_count = 200u;
+		for (auto room_id = room_id_t{1}; room_id <= room_count; ++room_id) {
+			container.add_or_update(make_room(room_id, static_cast<player_tag_t>(room_id), 4, 1));
+		}
+		std::atomic<bool> is_updating = true;
+		std::atomic<unsigned> wrong_total_count = 0;
+
+		// exercise
+		std::thread reader([&] {
+			while (is_updating.load(std::memory_order_acquire)) {
+				const auto result = container.search_with_total(room_data_sort_kind::name_ascending,
+					room_search_target_flag::public_room | room_search_target_flag::open_room, {});
+				if (result.total_room_count != room_count) { ++wrong_total_count; }
+			}
+		});
+		for (auto i = 0u; i < update_count; ++i) {
+			const auto room_id = static_cast<room_id_t>(i % room_count + 1);
+			container.try_reserve_player_for_join(room_id, game_host_connection_establish_mode::builtin, {});
+			container.try_release_player_join_reservation(room_id);
+		}
+		is_updating.store(false, std::memory_order_release);
+		reader.join();
+
+		// verify
+		BOOST_CHECK_EQUAL(wrong_total_count.load(), 0);
+		for (auto room_id = room_id_t{1}; room_id <= room_count; ++room_id) {
+			BOOST_CHECK_EQUAL(container.get(room_id).current_player_count, 1);
+		}
+	}
+
 BOOST_AUTO_TEST_SUITE_END()
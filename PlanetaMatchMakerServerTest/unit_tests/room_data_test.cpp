@@ -107,6 +107,22 @@ BOOST_AUTO_TEST_SUITE(room_data_test)
 			std::out_of_range);
 	}
 
+	BOOST_AUTO_TEST_CASE(test_ordered_before_breaks_create_datetime_tie_by_room_id) {
+		const auto first = make_room(1, u8"bob", 1);
+		const auto second = make_room(2, u8"alice", 1);
+
+		BOOST_CHECK(pgl::is_room_data_ordered_before(pgl::room_data_sort_kind::create_datetime_ascending, first, second));
+		BOOST_CHECK(!pgl::is_room_data_ordered_before(pgl::room_data_sort_kind::create_datetime_ascending, second, first));
+		BOOST_CHECK(pgl::is_room_data_ordered_before(pgl::room_data_sort_kind::create_datetime_descending, second, first));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_ordered_before_rejects_invalid_sort_kind) {
+		const auto room = make_room(1, u8"bob", 1);
+
+		BOOST_CHECK_THROW(pgl::is_room_data_ordered_before(static_cast<pgl::room_data_sort_kind>(255), room, room),
+			std::out_of_range);
+	}
+
 	BOOST_AUTO_TEST_CASE(test_compare_function_prioritizes_exact_search_name) {
 		const auto compare = pgl::get_room_data_compare_function(
 			pgl::room_data_sort_kind::name_ascending, {u8"bob", 0});
@@ -137,6 +153,14 @@ BOOST_AUTO_TEST_SUITE(room_data_test)
 		BOOST_CHECK(filter(make_room(4, u8"private-closed", 1, private_closed_room)));
 	}
 
+	BOOST_AUTO_TEST_CASE(test_is_player_name_contained_checks_substring) {
+		BOOST_CHECK(pgl::is_player_name_contained(u8"malice", u8"lic"));
+		BOOST_CHECK(pgl::is_player_name_contained(u8"malice", u8"malice"));
+		BOOST_CHECK(pgl::is_player_name_contained(u8"malice", u8""));
+		BOOST_CHECK(!pgl::is_player_name_contained(u8"malice", u8"alicia"));
+		BOOST_CHECK(!pgl::is_player_name_contained(u8"bob", u8"bobby"));
+	}
+
 	BOOST_AUTO_TEST_CASE(test_filter_function_matches_search_name_substring) {
 		const auto all_room_statuses = pgl::room_search_target_flag::public_room |
 			pgl::room_search_target_flag::private_room |
@@ -171,6 +195,76 @@ BOOST_AUTO_TEST_SUITE(room_data_test)
 		BOOST_CHECK(!filter(make_room(3, u8"bob", 42, public_open_room)));
 	}
 
+	BOOST_AUTO_TEST_CASE(test_name_order_compares_utf8_bytes_as_unsigned) {
+		const pgl::room_data_order<pgl::room_data_sort_kind::name_ascending> order;
+		const auto ascii_room = make_room(1, u8"zeta", 1);
+		const auto non_ascii_room = make_room(2, u8"\u00e9clair", 1);
+		const auto prefix_room = make_room(3, u8"zet", 1);
+
+		BOOST_CHECK(order(ascii_room, non_ascii_room));
+		BOOST_CHECK(!order(non_ascii_room, ascii_room));
+		BOOST_CHECK(order(prefix_room, ascii_room));
+		BOOST_CHECK(!order(ascii_room, ascii_room));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_visit_room_data_order_selects_order_of_sort_kind) {
+		const auto sort_kind = pgl::visit_room_data_order(pgl::room_data_sort_kind::create_datetime_descending,
+			[](const auto order) { return decltype(order)::sort_kind; });
+
+		BOOST_CHECK(sort_kind == pgl::room_data_sort_kind::create_datetime_descending);
+		BOOST_CHECK_THROW(pgl::visit_room_data_order(static_cast<pgl::room_data_sort_kind>(255),
+			[](const auto) { return 0; }), std::out_of_range);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_visit_room_data_filter_matches_filter_function) {
+		const std::vector rooms{
+			make_room(1, u8"alice", 42, public_open_room),
+			make_room(2, u8"alice", 43, private_open_room),
+			make_room(3, u8"malice", 42, public_closed_room),
+			make_room(4, u8"bob", 42, private_closed_room),
+		};
+		const auto all_room_statuses = pgl::room_search_target_flag::public_room |
+			pgl::room_search_target_flag::private_room |
+			pgl::room_search_target_flag::open_room |
+			pgl::room_search_target_flag::closed_room;
+		const std::vector<pgl::player_full_name> search_full_names{
+			{u8"", 0}, {u8"lic", 0}, {u8"", 42}, {u8"ali", 42},
+		};
+
+		for (auto&& search_full_name : search_full_names) {
+			for (auto&& search_target_flags : {all_room_statuses, pgl::room_search_target_flag::public_room |
+				     pgl::room_search_target_flag::open_room}) {
+				const auto filter_function = pgl::get_room_data_filter_function(search_target_flags, search_full_name);
+				pgl::visit_room_data_filter(search_target_flags, search_full_name, [&](const auto& filter) {
+					for (auto&& room : rooms) { BOOST_CHECK_EQUAL(filter(room), filter_function(room)); }
+				});
+			}
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(test_make_room_summary_copies_searched_fields) {
+		const auto room = make_room(123, u8"alice", 42, private_open_room, pgl::datetime(2024, 2, 3));
+
+		const auto summary = pgl::make_room_summary(room);
+
+		BOOST_CHECK_EQUAL(summary.room_id, room.room_id);
+		BOOST_CHECK(summary.host_player_full_name == room.host_player_full_name);
+		BOOST_CHECK(summary.setting_flags == room.setting_flags);
+		BOOST_CHECK_EQUAL(summary.max_player_count, room.max_player_count);
+		BOOST_CHECK_EQUAL(summary.current_player_count, room.current_player_count);
+		BOOST_CHECK(summary.create_datetime == room.create_datetime);
+		BOOST_CHECK(summary.game_host_connection_establish_mode == room.game_host_connection_establish_mode);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_room_data_order_orders_summaries_like_room_data) {
+		const pgl::room_data_order<pgl::room_data_sort_kind::name_descending> order;
+		const auto first = make_room(1, u8"bob", 1);
+		const auto second = make_room(2, u8"alice", 1);
+
+		BOOST_CHECK_EQUAL(order(pgl::make_room_summary(first), pgl::make_room_summary(second)), order(first, second));
+		BOOST_CHECK_EQUAL(order(pgl::make_room_summary(second), pgl::make_room_summary(first)), order(second, first));
+	}
+
 	BOOST_AUTO_TEST_CASE(test_room_data_stream_operator_outputs_id_and_host_full_name) {
 		const auto room = make_room(123, u8"alice", 42);
 		std::ostringstream stream;
@@ -0,0 +1,70 @@
+#include <set>
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/room/room_id_codec.hpp"
+
+using namespace pgl;
+
+BOOST_AUTO_TEST_SUITE(room_id_codec_test)
+
+	BOOST_AUTO_TEST_CASE(test_decode_restores_encoded_location) {
+		// set up
+		const auto codec = room_id_codec(12345, 4);
+
+		for (auto shard_index = size_t{0}; shard_index < 4; ++shard_index) {
+			for (auto slot_index = 0u; slot_index < 100; ++slot_index) {
+				// exercise
+				const auto location = codec.decode(codec.encode({shard_index, {slot_index, slot_index % 7}}));
+
+				// verify
+				BOOST_CHECK_EQUAL(location.shard_index, shard_index);
+				BOOST_CHECK_EQUAL(location.slot.index, slot_index);
+				BOOST_CHECK_EQUAL(location.slot.generation, slot_index % 7);
+			}
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(test_encode_does_not_issue_sequential_room_ids) {
+		// set up
+		const auto codec = room_id_codec(12345, 1);
+
+		// exercise
+		auto sequential_count = 0;
+		std::set<room_id_t> room_ids;
+		for (auto slot_index = 0u; slot_index < 100; ++slot_index) {
+			const auto room_id = codec.encode({0, {slot_index, 0}});
+			if (room_ids.contains(room_id - 1)) { ++sequential_count; }
+			room_ids.insert(room_id);
+		}
+
+		// verify
+		BOOST_CHECK_EQUAL(room_ids.size(), 100);
+		BOOST_CHECK_LT(sequential_count, 5);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_different_keys_issue_different_room_ids) {
+		// set up
+		const auto codec1 = room_id_codec(1, 1);
+		const auto codec2 = room_id_codec(2, 1);
+
+		// exercise & verify
+		BOOST_CHECK_NE(codec1.encode({0, {0, 0}}), codec2.encode({0, {0, 0}}));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_constructor_throws_with_invalid_shard_count) {
+		// exercise & verify
+		BOOST_CHECK_THROW(room_id_codec(1, 0), std::invalid_argument);
+		BOOST_CHECK_THROW(room_id_codec(1, (size_t{1} << room_id_codec::global_slot_index_bit_count) + 1),
+			std::invalid_argument);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_max_slot_count_is_divided_by_shard_count) {
+		// set up
+		const auto codec = room_id_codec(1, 4);
+
+		// exercise & verify
+		BOOST_CHECK_EQUAL(codec.max_slot_count(), (size_t{1} << room_id_codec::global_slot_index_bit_count) / 4);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/room/room_table.hpp"
+
+using namespace pgl;
+
+namespace {
+	room_data make_room(const room_id_t room_id, const uint8_t current_player_count, const char8_t* host_name = u8"host",
+		const datetime create_datetime = datetime(2024, 1, 1)) {
+		room_data data{};
+		data.room_id = room_id;
+		data.host_player_full_name = { host_name, static_cast<player_tag_t>(room_id) };
+		data.create_datetime = create_datetime;
+		data.max_player_count = 4;
+		data.current_player_count = current_player_count;
+		return data;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(room_table_test)
+
+	BOOST_AUTO_TEST_CASE(test_with_room_adds_room_sorted_by_room_id) {
+		// set up
+		const auto table = room_table().with_room(make_room(3, 1))->with_room(make_room(1, 1));
+
+		// exercise
+		const auto new_table = table->with_room(make_room(2, 1));
+
+		// verify
+		const std::vector<room_id_t> expected{1, 2, 3};
+		std::vector<room_id_t> room_ids;
+		std::ranges::transform(new_table->rooms(), std::back_inserter(room_ids), &room_summary::room_id);
+		BOOST_CHECK_EQUAL_COLLECTIONS(room_ids.begin(), room_ids.end(), expected.begin(), expected.end());
+		BOOST_CHECK_EQUAL(table->size(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_with_room_replaces_existing_room_without_changing_original_table) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1));
+
+		// exercise
+		const auto new_table = table->with_room(make_room(1, 3));
+
+		// verify
+		BOOST_REQUIRE_EQUAL(new_table->size(), 1);
+		BOOST_CHECK_EQUAL(new_table->get(1).current_player_count, 3);
+		BOOST_CHECK_EQUAL(table->get(1).current_player_count, 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_without_room_removes_room_without_changing_original_table) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1))->with_room(make_room(2, 1));
+
+		// exercise
+		const auto new_table = table->without_room(1);
+
+		// verify
+		BOOST_REQUIRE_EQUAL(new_table->size(), 1);
+		BOOST_CHECK_EQUAL(new_table->rooms().begin()->room_id, 2);
+		BOOST_CHECK_EQUAL(table->size(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_without_room_ignores_nonexistent_room) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1));
+
+		// exercise
+		const auto new_table = table->without_room(2);
+
+		// verify
+		BOOST_CHECK_EQUAL(new_table->size(), 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_with_room_keeps_orders_sorted) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1, u8"carol", datetime(2024, 1, 2)))
+		                               ->with_room(make_room(2, 1, u8"alice", datetime(2024, 1, 3)));
+
+		// exercise
+		const auto new_table = table->with_room(make_room(3, 1, u8"bob", datetime(2024, 1, 1)));
+
+		// verify
+		const std::vector<room_id_t> expected_name_order{2, 3, 1};
+		const std::vector<room_id_t> expected_create_datetime_order{3, 1, 2};
+		const auto& name_order = new_table->get_order(room_setting_flag::none, room_data_sort_kind::name_ascending);
+		const auto& create_datetime_order = new_table->get_order(room_setting_flag::none, room_data_sort_kind::create_datetime_descending);
+		BOOST_CHECK_EQUAL_COLLECTIONS(name_order.begin(), name_order.end(),
+			expected_name_order.begin(), expected_name_order.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(create_datetime_order.begin(), create_datetime_order.end(),
+			expected_create_datetime_order.begin(), expected_create_datetime_order.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_with_room_shares_orders_if_sort_keys_are_not_changed) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1))->with_room(make_room(2, 1));
+
+		// exercise
+		const auto new_table = table->with_room(make_room(1, 3));
+
+		// verify
+		BOOST_CHECK_EQUAL(&new_table->get_order(room_setting_flag::none, room_data_sort_kind::name_ascending),
+			&table->get_order(room_setting_flag::none, room_data_sort_kind::name_ascending));
+		BOOST_CHECK_EQUAL(&new_table->get_order(room_setting_flag::none, room_data_sort_kind::create_datetime_ascending),
+			&table->get_order(room_setting_flag::none, room_data_sort_kind::create_datetime_ascending));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_with_room_keeps_rooms_and_orders_of_many_rooms_sorted) {
+		// set up
+		auto table = std::make_shared<const room_table>();
+		for (auto room_id = room_id_t{1000}; room_id > 0; --room_id) {
+			table = table->with_room(make_room(room_id, 1, u8"host", datetime(2024, 1, 1 + room_id % 28)));
+		}
+
+		// exercise
+		for (auto room_id = room_id_t{2}; room_id <= 1000; room_id += 2) { table = table->without_room(room_id); }
+		table = table->with_room(make_room(1, 3));
+
+		// verify
+		BOOST_REQUIRE_EQUAL(table->size(), 500);
+		BOOST_CHECK(std::ranges::is_sorted(table->rooms(), {}, &room_summary::room_id));
+		BOOST_CHECK_EQUAL(table->get(1).current_player_count, 3);
+		const auto& order = table->get_order(room_setting_flag::none, room_data_sort_kind::create_datetime_ascending);
+		BOOST_REQUIRE_EQUAL(std::ranges::distance(order), 500);
+		BOOST_CHECK(std::ranges::is_sorted(order, {}, [&table](const room_id_t id) {
+			return table->get(id).create_datetime;
+		}));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_with_room_moves_room_in_order_if_sort_key_is_changed) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1, u8"alice"))->with_room(make_room(2, 1, u8"bob"));
+
+		// exercise
+		const auto new_table = table->with_room(make_room(1, 1, u8"carol"));
+
+		// verify
+		const std::vector<room_id_t> expected_order{2, 1};
+		const auto& order = new_table->get_order(room_setting_flag::none, room_data_sort_kind::name_ascending);
+		BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected_order.begin(), expected_order.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_without_room_removes_room_from_orders) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1))->with_room(make_room(2, 1));
+
+		// exercise
+		const auto new_table = table->without_room(1);
+
+		// verify
+		const std::vector<room_id_t> expected_order{2};
+		const auto& order = new_table->get_order(room_setting_flag::none, room_data_sort_kind::create_datetime_ascending);
+		BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected_order.begin(), expected_order.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_with_room_moves_room_to_partition_of_new_setting_flags) {
+		// set up
+		auto open_room = make_room(1, 1);
+		open_room.setting_flags = room_setting_flag::public_room | room_setting_flag::open_room;
+		auto closed_room = open_room;
+		closed_room.setting_flags = room_setting_flag::public_room;
+		const auto table = room_table().with_room(open_room);
+
+		// exercise
+		const auto new_table = table->with_room(closed_room);
+
+		// verify
+		BOOST_CHECK(new_table->get_order(open_room.setting_flags, room_data_sort_kind::name_ascending).empty());
+		BOOST_CHECK_EQUAL(new_table->get_order(closed_room.setting_flags, room_data_sort_kind::name_ascending).size(), 1);
+		BOOST_CHECK_EQUAL(
+			new_table->get_order(closed_room.setting_flags, room_data_sort_kind::create_datetime_ascending).size(), 1);
+		BOOST_CHECK_EQUAL(table->get_order(open_room.setting_flags, room_data_sort_kind::name_ascending).size(), 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_find_name_candidates_returns_rooms_which_have_all_trigrams) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1, u8"alice"))
+		                               ->with_room(make_room(2, 1, u8"malice"))
+		                               ->with_room(make_room(3, 1, u8"bob"));
+
+		// exercise
+		const auto candidates = table->find_name_candidates(u8"lice");
+
+		// verify
+		BOOST_REQUIRE(candidates.has_value());
+		const std::vector<room_id_t> expected{1, 2};
+		BOOST_CHECK_EQUAL_COLLECTIONS(candidates->begin(), candidates->end(), expected.begin(), expected.end());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_find_name_candidates_returns_nullopt_for_short_search_name) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1, u8"alice"));
+
+		// exercise and verify
+		BOOST_CHECK(!table->find_name_candidates(u8"al").has_value());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_find_name_candidates_follows_renamed_and_removed_rooms) {
+		// set up
+		const auto table = room_table().with_room(make_room(1, 1, u8"alice"))->with_room(make_room(2, 1, u8"alice"));
+
+		// exercise
+		const auto new_table = table->with_room(make_room(1, 1, u8"bob"))->without_room(2);
+
+		// verify
+		BOOST_CHECK(new_table->find_name_candidates(u8"alice")->empty());
+		const auto candidates = new_table->find_name_candidates(u8"bob");
+		BOOST_REQUIRE_EQUAL(candidates->size(), 1);
+		BOOST_CHECK_EQUAL(candidates->front(), 1);
+		BOOST_CHECK_EQUAL(table->find_name_candidates(u8"alice")->size(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_with_room_shares_untouched_name_posting_lists) {
+		// set up
+		auto table = std::make_shared<const room_table>();
+		for (auto room_id = room_id_t{1}; room_id <= 300; ++room_id) {
+			table = table->with_room(make_room(room_id, 1, u8"player"));
+		}
+
+		// exercise
+		const auto new_table = table->with_room(make_room(301, 1, u8"zzz"));
+
+		// verify
+		const auto posting_list = table->get_name_posting_list(u8"pla");
+		const auto new_posting_list = new_table->get_name_posting_list(u8"pla");
+		BOOST_REQUIRE_EQUAL(posting_list.size(), 300);
+		BOOST_CHECK(std::ranges::equal(posting_list, new_posting_list,
+			[](const auto& left, const auto& right) { return &left == &right; }));
+		const auto added_posting_list = new_table->get_name_posting_list(u8"zzz");
+		BOOST_REQUIRE_EQUAL(added_posting_list.size(), 1);
+		BOOST_CHECK_EQUAL(added_posting_list.begin()->room_id, 301);
+		BOOST_CHECK(table->get_name_posting_list(u8"zzz").empty());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_get_name_posting_list_rejects_name_which_is_not_trigram) {
+		BOOST_CHECK_THROW(static_cast<void>(room_table().get_name_posting_list(u8"play")), std::invalid_argument);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_get_order_rejects_invalid_sort_kind) {
+		BOOST_CHECK_THROW(static_cast<void>(room_table().get_order(room_setting_flag::none,
+			static_cast<room_data_sort_kind>(255))),
+			std::out_of_range);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
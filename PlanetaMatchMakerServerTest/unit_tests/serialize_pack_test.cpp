@@ -73,6 +73,17 @@ BOOST_AUTO_TEST_SUITE(serialize_pack_test)
 		BOOST_CHECK_EQUAL(expected2, actual2);
 	}
 
+	BOOST_AUTO_TEST_CASE(test_pack_data_to_array_matches_pack_data) {
+		const test_struct1 data1{1, 2, {3, 4, 5, 6}};
+		const test_struct2 data2{-7, {8, 9}};
+
+		const auto expected = pgl::pack_data(data1, data2);
+		const auto actual = pgl::pack_data_to_array(data1, data2);
+
+		BOOST_CHECK_EQUAL(actual.size(), expected.size());
+		BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+	}
+
 	BOOST_AUTO_TEST_CASE(test_unpack_lack_of_data_exception) {
 		using test_t = uint64_t;
 		test_t actual;
@@ -120,12 +120,20 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 				"common", {
 					{"enable_session_key_check", false},
 					{"time_out_seconds", 100},
+					{"timer_wheel_tick_milliseconds", 250},
 					{"ip_version", "v6"},
 					{"port", 12345},
 					{"max_connection_per_thread", 500},
+					{"warm_connection_per_thread", 50},
 					{"thread", 400},
 					{"max_room_count", 300},
-					{"max_player_per_room", 200}
+					{"max_player_per_room", 200},
+					{"room_shard_count", 8},
+					{"list_room_reply_cache_size", 32},
+					{"enable_slot_map_room_storage", true},
+					{"enable_reuse_port", true},
+					{"enable_io_context_per_thread", true},
+					{"enable_cpu_affinity", true}
 				}
 			},
 			{
@@ -156,7 +164,13 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 					{"mode", "plain"},
 					{"certificate_path", "test.crt"},
 					{"private_key_path", "test.key"},
-					{"reload_on_sighup", true}
+					{"reload_on_sighup", true},
+					{"session_cache_size", 100},
+					{"enable_session_ticket", false},
+					{"session_ticket_key_rotation_seconds", 600},
+					{"handshake_thread", 2},
+					{"max_pending_handshake", 50},
+					{"enable_ktls", true}
 				}
 			}
 		};
@@ -168,12 +182,20 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 
 		// verify
 		BOOST_CHECK_EQUAL(setting.common.time_out_seconds, 100);
+		BOOST_CHECK_EQUAL(setting.common.timer_wheel_tick_milliseconds, 250);
 		BOOST_CHECK(setting.common.ip_version == ip_version::v6);
 		BOOST_CHECK_EQUAL(setting.common.port, 12345);
 		BOOST_CHECK_EQUAL(setting.common.max_connection_per_thread, 500);
+		BOOST_CHECK_EQUAL(setting.common.warm_connection_per_thread, 50);
 		BOOST_CHECK_EQUAL(setting.common.thread, 400);
 		BOOST_CHECK_EQUAL(setting.common.max_room_count, 300);
 		BOOST_CHECK_EQUAL(setting.common.max_player_per_room, 200);
+		BOOST_CHECK_EQUAL(setting.common.room_shard_count, 8);
+		BOOST_CHECK_EQUAL(setting.common.list_room_reply_cache_size, 32);
+		BOOST_CHECK_EQUAL(setting.common.enable_slot_map_room_storage, true);
+		BOOST_CHECK_EQUAL(setting.common.enable_reuse_port, true);
+		BOOST_CHECK_EQUAL(setting.common.enable_io_context_per_thread, true);
+		BOOST_CHECK_EQUAL(setting.common.enable_cpu_affinity, true);
 		// Cannot use BOOST_CHECK_EQUAL because it does not support char8_t
 		BOOST_CHECK(setting.authentication.game_id == u8"test");
 		BOOST_CHECK_EQUAL(setting.authentication.enable_game_version_check, true);
@@ -191,6 +213,12 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 		BOOST_CHECK_EQUAL(setting.tls.certificate_path, "test.crt");
 		BOOST_CHECK_EQUAL(setting.tls.private_key_path, "test.key");
 		BOOST_CHECK_EQUAL(setting.tls.reload_on_sighup, true);
+		BOOST_CHECK_EQUAL(setting.tls.session_cache_size, 100);
+		BOOST_CHECK_EQUAL(setting.tls.enable_session_ticket, false);
+		BOOST_CHECK_EQUAL(setting.tls.session_ticket_key_rotation_seconds, 600);
+		BOOST_CHECK_EQUAL(setting.tls.handshake_thread, 2);
+		BOOST_CHECK_EQUAL(setting.tls.max_pending_handshake, 50);
+		BOOST_CHECK_EQUAL(setting.tls.enable_ktls, true);
 	}
 
 	BOOST_FIXTURE_TEST_CASE(load_from_json_file_minimal, setting_file_fixture) {
@@ -204,12 +232,20 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 
 		// verify
 		BOOST_CHECK_EQUAL(setting.common.time_out_seconds, 300);
+		BOOST_CHECK_EQUAL(setting.common.timer_wheel_tick_milliseconds, 100);
 		BOOST_CHECK(setting.common.ip_version == ip_version::v4);
 		BOOST_CHECK_EQUAL(setting.common.port, 57000);
 		BOOST_CHECK_EQUAL(setting.common.max_connection_per_thread, 1000);
+		BOOST_CHECK_EQUAL(setting.common.warm_connection_per_thread, 16);
 		BOOST_CHECK_EQUAL(setting.common.thread, 1);
 		BOOST_CHECK_EQUAL(setting.common.max_room_count, 1000);
 		BOOST_CHECK_EQUAL(setting.common.max_player_per_room, 16);
+		BOOST_CHECK_EQUAL(setting.common.room_shard_count, 1);
+		BOOST_CHECK_EQUAL(setting.common.list_room_reply_cache_size, 64);
+		BOOST_CHECK_EQUAL(setting.common.enable_slot_map_room_storage, false);
+		BOOST_CHECK_EQUAL(setting.common.enable_reuse_port, false);
+		BOOST_CHECK_EQUAL(setting.common.enable_io_context_per_thread, false);
+		BOOST_CHECK_EQUAL(setting.common.enable_cpu_affinity, false);
 		// Skip check setting.authentication.enable_game_version_check because it it required setting
 		BOOST_CHECK_EQUAL(setting.authentication.enable_game_version_check, false);
 		// Cannot use BOOST_CHECK_EQUAL because it does not support char8_t
@@ -226,6 +262,12 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 		BOOST_CHECK_EQUAL(setting.tls.certificate_path, "server.crt");
 		BOOST_CHECK_EQUAL(setting.tls.private_key_path, "server.key");
 		BOOST_CHECK_EQUAL(setting.tls.reload_on_sighup, false);
+		BOOST_CHECK_EQUAL(setting.tls.session_cache_size, 20480);
+		BOOST_CHECK_EQUAL(setting.tls.enable_session_ticket, true);
+		BOOST_CHECK_EQUAL(setting.tls.session_ticket_key_rotation_seconds, 3600);
+		BOOST_CHECK_EQUAL(setting.tls.handshake_thread, 0);
+		BOOST_CHECK_EQUAL(setting.tls.max_pending_handshake, 1024);
+		BOOST_CHECK_EQUAL(setting.tls.enable_ktls, false);
 	}
 
 	BOOST_FIXTURE_TEST_CASE(load_from_json_file_uses_setting_directory_as_default_tls_paths,
@@ -321,6 +363,7 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 			{
 				"common", {
 					{"max_connection_per_thread", sample},
+					{"warm_connection_per_thread", 50},
 				}
 			}
 		});
@@ -332,6 +375,7 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 
 		// verify
 		BOOST_CHECK_EQUAL(setting.common.max_connection_per_thread, sample);
+		BOOST_CHECK_EQUAL(setting.common.warm_connection_per_thread, 50);
 	}
 
 	BOOST_DATA_TEST_CASE_F(setting_file_fixture, test_load_from_json_file_thread_valid,
@@ -566,22 +610,37 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 		unit_test::data::make({
 			std::tuple{"common", "time_out_seconds", - 1},
 			std::tuple{"common", "time_out_seconds", 65536},
+			std::tuple{"common", "timer_wheel_tick_milliseconds", -1},
+			std::tuple{"common", "timer_wheel_tick_milliseconds", 10001},
 			std::tuple{"common", "port", -1},
 			std::tuple{"common", "port", 65536},
 			std::tuple{"common", "max_connection_per_thread", 0},
 			std::tuple{"common", "max_connection_per_thread", 65536},
+			std::tuple{"common", "warm_connection_per_thread", 0},
+			std::tuple{"common", "warm_connection_per_thread", 65536},
 			std::tuple{"common", "thread", 0},
 			std::tuple{"common", "thread", 65536},
 			std::tuple{"common", "max_room_count", 0},
 			std::tuple{"common", "max_room_count", 65536},
 			std::tuple{"common", "max_player_per_room", 0},
 			std::tuple{"common", "max_player_per_room", 256},
+			std::tuple{"common", "room_shard_count", 0},
+			std::tuple{"common", "room_shard_count", 257},
+			std::tuple{"common", "list_room_reply_cache_size", 1025},
 			std::tuple{"connection_test", "connection_check_tcp_time_out_seconds", 0},
 			std::tuple{"connection_test", "connection_check_tcp_time_out_seconds", 3601},
 			std::tuple{"connection_test", "connection_check_udp_time_out_seconds", 0},
 			std::tuple{"connection_test", "connection_check_udp_time_out_seconds", 3601},
 			std::tuple{"connection_test", "connection_check_udp_try_count", 0},
 			std::tuple{"connection_test", "connection_check_udp_try_count", 101},
+			std::tuple{"tls", "session_cache_size", -1},
+			std::tuple{"tls", "session_cache_size", 65536},
+			std::tuple{"tls", "session_ticket_key_rotation_seconds", 59},
+			std::tuple{"tls", "session_ticket_key_rotation_seconds", 86401},
+			std::tuple{"tls", "handshake_thread", -1},
+			std::tuple{"tls", "handshake_thread", 65536},
+			std::tuple{"tls", "max_pending_handshake", 0},
+			std::tuple{"tls", "max_pending_handshake", 65536},
 			}), section, key, value) {
 		// set up
 		const auto test_data = create_setting({
@@ -672,12 +731,20 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 		// set up
 		set_typed_env_var("PMMS_COMMON_ENABLE_SESSION_KEY_CHECK", false);
 		set_typed_env_var("PMMS_COMMON_TIME_OUT_SECONDS", 100);
+		set_typed_env_var("PMMS_COMMON_TIMER_WHEEL_TICK_MILLISECONDS", 250);
 		set_typed_env_var("PMMS_COMMON_IP_VERSION", "v6");
 		set_typed_env_var("PMMS_COMMON_PORT", 12345);
 		set_typed_env_var("PMMS_COMMON_MAX_CONNECTION_PER_THREAD", 500);
+		set_typed_env_var("PMMS_COMMON_WARM_CONNECTION_PER_THREAD", 50);
 		set_typed_env_var("PMMS_COMMON_MAX_THREAD", 400);
 		set_typed_env_var("PMMS_COMMON_MAX_ROOM_COUNT", 300);
 		set_typed_env_var("PMMS_COMMON_MAX_PLAYER_PER_ROOM", 200);
+		set_typed_env_var("PMMS_COMMON_ROOM_SHARD_COUNT", 8);
+		set_typed_env_var("PMMS_COMMON_LIST_ROOM_REPLY_CACHE_SIZE", 32);
+		set_typed_env_var("PMMS_COMMON_ENABLE_SLOT_MAP_ROOM_STORAGE", true);
+		set_typed_env_var("PMMS_COMMON_ENABLE_REUSE_PORT", true);
+		set_typed_env_var("PMMS_COMMON_ENABLE_IO_CONTEXT_PER_THREAD", true);
+		set_typed_env_var("PMMS_COMMON_ENABLE_CPU_AFFINITY", true);
 		set_typed_env_var("PMMS_AUTHENTICATION_GAME_ID", "test");
 		set_typed_env_var("PMMS_AUTHENTICATION_ENABLE_GAME_VERSION_CHECK", true);
 		set_typed_env_var("PMMS_AUTHENTICATION_GAME_VERSION", "1.0.0");
@@ -693,6 +760,12 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 		set_typed_env_var("PMMS_TLS_CERTIFICATE_PATH", "test.crt");
 		set_typed_env_var("PMMS_TLS_PRIVATE_KEY_PATH", "test.key");
 		set_typed_env_var("PMMS_TLS_RELOAD_ON_SIGHUP", true);
+		set_typed_env_var("PMMS_TLS_SESSION_CACHE_SIZE", 100);
+		set_typed_env_var("PMMS_TLS_ENABLE_SESSION_TICKET", false);
+		set_typed_env_var("PMMS_TLS_SESSION_TICKET_KEY_ROTATION_SECONDS", 600);
+		set_typed_env_var("PMMS_TLS_HANDSHAKE_THREAD", 2);
+		set_typed_env_var("PMMS_TLS_MAX_PENDING_HANDSHAKE", 50);
+		set_typed_env_var("PMMS_TLS_ENABLE_KTLS", true);
 
 		// exercise
 		server_setting setting;
@@ -700,12 +773,20 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 
 		// verify
 		BOOST_CHECK_EQUAL(setting.common.time_out_seconds, 100);
+		BOOST_CHECK_EQUAL(setting.common.timer_wheel_tick_milliseconds, 250);
 		BOOST_CHECK(setting.common.ip_version == ip_version::v6);
 		BOOST_CHECK_EQUAL(setting.common.port, 12345);
 		BOOST_CHECK_EQUAL(setting.common.max_connection_per_thread, 500);
+		BOOST_CHECK_EQUAL(setting.common.warm_connection_per_thread, 50);
 		BOOST_CHECK_EQUAL(setting.common.thread, 400);
 		BOOST_CHECK_EQUAL(setting.common.max_room_count, 300);
 		BOOST_CHECK_EQUAL(setting.common.max_player_per_room, 200);
+		BOOST_CHECK_EQUAL(setting.common.room_shard_count, 8);
+		BOOST_CHECK_EQUAL(setting.common.list_room_reply_cache_size, 32);
+		BOOST_CHECK_EQUAL(setting.common.enable_slot_map_room_storage, true);
+		BOOST_CHECK_EQUAL(setting.common.enable_reuse_port, true);
+		BOOST_CHECK_EQUAL(setting.common.enable_io_context_per_thread, true);
+		BOOST_CHECK_EQUAL(setting.common.enable_cpu_affinity, true);
 		// Cannot use BOOST_CHECK_EQUAL because it does not support char8_t
 		BOOST_CHECK(setting.authentication.game_id == u8"test");
 		BOOST_CHECK_EQUAL(setting.authentication.enable_game_version_check, true);
@@ -723,6 +804,12 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 		BOOST_CHECK_EQUAL(setting.tls.certificate_path, "test.crt");
 		BOOST_CHECK_EQUAL(setting.tls.private_key_path, "test.key");
 		BOOST_CHECK_EQUAL(setting.tls.reload_on_sighup, true);
+		BOOST_CHECK_EQUAL(setting.tls.session_cache_size, 100);
+		BOOST_CHECK_EQUAL(setting.tls.enable_session_ticket, false);
+		BOOST_CHECK_EQUAL(setting.tls.session_ticket_key_rotation_seconds, 600);
+		BOOST_CHECK_EQUAL(setting.tls.handshake_thread, 2);
+		BOOST_CHECK_EQUAL(setting.tls.max_pending_handshake, 50);
+		BOOST_CHECK_EQUAL(setting.tls.enable_ktls, true);
 	}
 
 	BOOST_FIXTURE_TEST_CASE(load_from_env_var_empty, env_var_fixture) {
@@ -734,12 +821,20 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 
 		// verify
 		BOOST_CHECK_EQUAL(setting.common.time_out_seconds, 300);
+		BOOST_CHECK_EQUAL(setting.common.timer_wheel_tick_milliseconds, 100);
 		BOOST_CHECK(setting.common.ip_version == ip_version::v4);
 		BOOST_CHECK_EQUAL(setting.common.port, 57000);
 		BOOST_CHECK_EQUAL(setting.common.max_connection_per_thread, 1000);
+		BOOST_CHECK_EQUAL(setting.common.warm_connection_per_thread, 16);
 		BOOST_CHECK_EQUAL(setting.common.thread, 1);
 		BOOST_CHECK_EQUAL(setting.common.max_room_count, 1000);
 		BOOST_CHECK_EQUAL(setting.common.max_player_per_room, 16);
+		BOOST_CHECK_EQUAL(setting.common.room_shard_count, 1);
+		BOOST_CHECK_EQUAL(setting.common.list_room_reply_cache_size, 64);
+		BOOST_CHECK_EQUAL(setting.common.enable_slot_map_room_storage, false);
+		BOOST_CHECK_EQUAL(setting.common.enable_reuse_port, false);
+		BOOST_CHECK_EQUAL(setting.common.enable_io_context_per_thread, false);
+		BOOST_CHECK_EQUAL(setting.common.enable_cpu_affinity, false);
 		// Skip check setting.authentication.enable_game_version_check because it it required setting
 		BOOST_CHECK_EQUAL(setting.authentication.enable_game_version_check, false);
 		// Cannot use BOOST_CHECK_EQUAL because it does not support char8_t
@@ -756,6 +851,12 @@ BOOST_AUTO_TEST_SUITE(server_setting_test)
 		BOOST_CHECK_EQUAL(setting.tls.certificate_path, "server.crt");
 		BOOST_CHECK_EQUAL(setting.tls.private_key_path, "server.key");
 		BOOST_CHECK_EQUAL(setting.tls.reload_on_sighup, false);
+		BOOST_CHECK_EQUAL(setting.tls.session_cache_size, 20480);
+		BOOST_CHECK_EQUAL(setting.tls.enable_session_ticket, true);
+		BOOST_CHECK_EQUAL(setting.tls.session_ticket_key_rotation_seconds, 3600);
+		BOOST_CHECK_EQUAL(setting.tls.handshake_thread, 0);
+		BOOST_CHECK_EQUAL(setting.tls.max_pending_handshake, 1024);
+		BOOST_CHECK_EQUAL(setting.tls.enable_ktls, false);
 	}
 
 	// Test only one case for each setting section because exhaustive test for validation is done in test of load_from_json_file
@@ -0,0 +1,112 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/server/session_pool_counter.hpp"
+
+using namespace pgl;
+
+BOOST_AUTO_TEST_SUITE(session_pool_counter_test)
+
+	BOOST_AUTO_TEST_CASE(test_try_add_waiting_session_adds_up_to_warm_session_count) {
+		// set up
+		auto counter = session_pool_counter(2, 10);
+
+		// exercise
+		const auto result1 = counter.try_add_waiting_session();
+		const auto result2 = counter.try_add_waiting_session();
+		const auto result3 = counter.try_add_waiting_session();
+
+		// verify
+		BOOST_CHECK(result1);
+		BOOST_CHECK(result2);
+		BOOST_CHECK(!result3);
+		BOOST_CHECK_EQUAL(counter.waiting_session_count(), 2);
+		BOOST_CHECK_EQUAL(counter.session_count(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_try_add_waiting_session_adds_after_connection_accepted) {
+		// set up
+		auto counter = session_pool_counter(1, 10);
+		static_cast<void>(counter.try_add_waiting_session());
+
+		// exercise
+		counter.on_connection_accepted();
+		const auto result = counter.try_add_waiting_session();
+
+		// verify
+		BOOST_CHECK(result);
+		BOOST_CHECK_EQUAL(counter.waiting_session_count(), 1);
+		BOOST_CHECK_EQUAL(counter.connected_session_count(), 1);
+		BOOST_CHECK_EQUAL(counter.session_count(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_try_add_waiting_session_does_not_exceed_max_session_count) {
+		// set up
+		auto counter = session_pool_counter(1, 2);
+		static_cast<void>(counter.try_add_waiting_session());
+		counter.on_connection_accepted();
+		static_cast<void>(counter.try_add_waiting_session());
+		counter.on_connection_accepted();
+
+		// exercise
+		const auto result = counter.try_add_waiting_session();
+
+		// verify
+		BOOST_CHECK(!result);
+		BOOST_CHECK_EQUAL(counter.waiting_session_count(), 0);
+		BOOST_CHECK_EQUAL(counter.session_count(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_on_connection_closed_keeps_session_while_waiting_sessions_are_fewer_than_warm_count) {
+		// set up
+		auto counter = session_pool_counter(1, 2);
+		static_cast<void>(counter.try_add_waiting_session());
+		counter.on_connection_accepted();
+		static_cast<void>(counter.try_add_waiting_session());
+		counter.on_connection_accepted();
+
+		// exercise
+		const auto result1 = counter.on_connection_closed();
+		const auto result2 = counter.on_connection_closed();
+
+		// verify
+		BOOST_CHECK(result1);
+		BOOST_CHECK(!result2);
+		BOOST_CHECK_EQUAL(counter.waiting_session_count(), 1);
+		BOOST_CHECK_EQUAL(counter.connected_session_count(), 0);
+		BOOST_CHECK_EQUAL(counter.session_count(), 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_peak_connected_session_count_is_kept_after_connections_closed) {
+		// set up
+		auto counter = session_pool_counter(2, 10);
+		for (auto i = 0; i < 3; ++i) {
+			static_cast<void>(counter.try_add_waiting_session());
+			counter.on_connection_accepted();
+		}
+
+		// exercise
+		for (auto i = 0; i < 3; ++i) { static_cast<void>(counter.on_connection_closed()); }
+
+		// verify
+		BOOST_CHECK_EQUAL(counter.connected_session_count(), 0);
+		BOOST_CHECK_EQUAL(counter.peak_connected_session_count(), 3);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_warm_session_count_is_limited_to_max_session_count) {
+		// set up
+		auto counter = session_pool_counter(5, 2);
+
+		// exercise
+		while (counter.try_add_waiting_session()) {}
+
+		// verify
+		BOOST_CHECK_EQUAL(counter.waiting_session_count(), 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_constructor_throws_with_zero_session_count) {
+		// exercise and verify
+		BOOST_CHECK_THROW(session_pool_counter(0, 1), std::invalid_argument);
+		BOOST_CHECK_THROW(session_pool_counter(1, 0), std::invalid_argument);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,120 @@
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/data/slot_map.hpp"
+
+using namespace pgl;
+
+namespace {
+	// Packs the index into upper bits and the generation into lower 8 bits.
+	struct test_key_codec final {
+		size_t slot_count = 4;
+
+		[[nodiscard]] uint32_t encode(const slot_location& location) const {
+			return location.index << 8 | (location.generation & 0xff);
+		}
+
+		[[nodiscard]] slot_location decode(const uint32_t key) const { return {key >> 8, key & 0xff}; }
+
+		[[nodiscard]] size_t max_slot_count() const { return slot_count; }
+	};
+
+	using test_slot_map = slot_map<uint32_t, int, test_key_codec>;
+}
+
+BOOST_AUTO_TEST_SUITE(slot_map_test)
+
+	BOOST_AUTO_TEST_CASE(test_emplace_adds_value_with_next_key) {
+		// set up
+		auto map = test_slot_map();
+		const auto key = map.next_key();
+
+		// exercise
+		const auto [it, is_added] = map.emplace(key, 10);
+
+		// verify
+		BOOST_CHECK(is_added);
+		BOOST_CHECK_EQUAL(it->first, key);
+		BOOST_CHECK_EQUAL(map.at(key), 10);
+		BOOST_CHECK_EQUAL(map.size(), 1);
+		BOOST_CHECK_NE(map.next_key(), key);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_emplace_throws_with_key_not_issued) {
+		// set up
+		auto map = test_slot_map();
+		const auto key = map.next_key() + 1;
+
+		// exercise & verify
+		BOOST_CHECK_THROW(map.emplace(key, 10), std::invalid_argument);
+		BOOST_CHECK(map.empty());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_insert_or_assign_updates_existing_value) {
+		// set up
+		auto map = test_slot_map();
+		const auto key = map.next_key();
+		map.emplace(key, 10);
+
+		// exercise
+		const auto [it, is_added] = map.insert_or_assign(key, 20);
+
+		// verify
+		BOOST_CHECK(!is_added);
+		BOOST_CHECK_EQUAL(map.at(key), 20);
+		BOOST_CHECK_EQUAL(map.size(), 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_erased_key_does_not_find_value_added_to_reused_slot) {
+		// set up
+		auto map = test_slot_map();
+		const auto old_key = map.next_key();
+		map.emplace(old_key, 10);
+		map.erase(old_key);
+
+		// exercise
+		const auto new_key = map.next_key();
+		map.emplace(new_key, 20);
+
+		// verify
+		BOOST_CHECK_EQUAL(test_key_codec().decode(new_key).index, test_key_codec().decode(old_key).index);
+		BOOST_CHECK_NE(new_key, old_key);
+		BOOST_CHECK(!map.contains(old_key));
+		BOOST_CHECK(map.find(old_key) == map.end());
+		BOOST_CHECK_THROW(static_cast<void>(map.at(old_key)), std::out_of_range);
+		BOOST_CHECK_EQUAL(map.at(new_key), 20);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_iteration_skips_erased_slots) {
+		// set up
+		auto map = test_slot_map();
+		std::vector<uint32_t> keys;
+		for (auto i = 0; i < 3; ++i) {
+			keys.push_back(map.next_key());
+			map.emplace(keys.back(), i);
+		}
+		map.erase(keys[1]);
+
+		// exercise
+		std::vector<int> values;
+		for (auto&& [key, value] : map) { values.push_back(value); }
+
+		// verify
+		BOOST_CHECK_EQUAL(map.size(), 2);
+		BOOST_REQUIRE_EQUAL(values.size(), 2);
+		BOOST_CHECK_EQUAL(values[0], 0);
+		BOOST_CHECK_EQUAL(values[1], 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_next_key_throws_when_all_slots_are_used) {
+		// set up
+		auto map = test_slot_map(test_key_codec{2});
+		map.emplace(map.next_key(), 0);
+		map.emplace(map.next_key(), 1);
+
+		// exercise & verify
+		BOOST_CHECK_THROW(static_cast<void>(map.next_key()), std::length_error);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -527,6 +527,41 @@ BOOST_AUTO_TEST_SUITE(thread_safe_data_container_test)
 		BOOST_CHECK_EQUAL(actual2, true);
 	}
 
+	BOOST_AUTO_TEST_CASE(test_try_remove_releases_unique_variable) {
+		// set up
+		auto container = container_t();
+		auto data_using_removed_unique1 = data2;
+		data_using_removed_unique1.unique1 = data1.unique1;
+		container.add_or_update(data1);
+		container.try_remove(data1.id);
+
+		// exercise
+		const auto result = container.add_or_update(data_using_removed_unique1);
+		const auto actual = container.get(data_using_removed_unique1.id);
+
+		// verify
+		BOOST_CHECK_EQUAL(result, true);
+		BOOST_CHECK_EQUAL(actual, data_using_removed_unique1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_id_only_container_updates_data) {
+		// set up
+		auto container = thread_safe_data_container<test_struct1, &test_struct1::id>();
+		auto updated_data1 = data2;
+		updated_data1.id = data1.id;
+		container.add_or_update(data1);
+		container.add_or_update(data2);
+
+		// exercise
+		const auto result = container.add_or_update(updated_data1);
+		const auto actual = container.get(data1.id);
+
+		// verify
+		BOOST_CHECK_EQUAL(result, false);
+		BOOST_CHECK_EQUAL(actual, updated_data1);
+		BOOST_CHECK_EQUAL(container.size(), 2);
+	}
+
 	BOOST_AUTO_TEST_CASE(test_try_remove_data_not_exist) {
 		// set up
 		auto container = container_t();
@@ -0,0 +1,158 @@
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include <boost/asio.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/async/timer_wheel.hpp"
+
+using namespace pgl;
+using namespace std::chrono_literals;
+
+namespace {
+	using clock = std::chrono::steady_clock;
+
+	struct expiry_record final {
+		std::optional<clock::time_point> expired_time;
+		int expired_count = 0;
+	};
+
+	timer_wheel_deadline make_deadline(expiry_record& record) {
+		return {
+			[](void* const context) noexcept {
+				auto& record = *static_cast<expiry_record*>(context);
+				record.expired_time = clock::now();
+				++record.expired_count;
+			},
+			&record
+		};
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(timer_wheel_test)
+
+	BOOST_AUTO_TEST_CASE(test_constructor_throws_for_invalid_parameters) {
+		// set up
+		boost::asio::io_context io_context;
+
+		// exercise & verify
+		BOOST_CHECK_THROW(timer_wheel(io_context.get_executor(), 0ms), std::invalid_argument);
+		BOOST_CHECK_THROW(timer_wheel(io_context.get_executor(), 10ms, 0), std::invalid_argument);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_armed_deadline_expires_not_before_its_time) {
+		// set up
+		boost::asio::io_context io_context;
+		const auto wheel = std::make_shared<timer_wheel>(io_context.get_executor(), 10ms);
+		expiry_record record;
+		auto deadline = make_deadline(record);
+		const auto armed_time = clock::now();
+
+		// exercise
+		wheel->arm(deadline, 35ms);
+		io_context.run_for(2s);
+
+		// verify
+		BOOST_REQUIRE(record.expired_time.has_value());
+		BOOST_CHECK(*record.expired_time - armed_time >= 35ms);
+		BOOST_CHECK_EQUAL(record.expired_count, 1);
+		BOOST_CHECK(!deadline.is_armed());
+		BOOST_CHECK_EQUAL(wheel->armed_count(), 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_deadline_beyond_slot_count_expires_after_rounds) {
+		// set up
+		boost::asio::io_context io_context;
+		const auto wheel = std::make_shared<timer_wheel>(io_context.get_executor(), 5ms, 4);
+		expiry_record record;
+		auto deadline = make_deadline(record);
+		const auto armed_time = clock::now();
+
+		// exercise
+		wheel->arm(deadline, 60ms);
+		io_context.run_for(2s);
+
+		// verify
+		BOOST_REQUIRE(record.expired_time.has_value());
+		BOOST_CHECK(*record.expired_time - armed_time >= 60ms);
+		BOOST_CHECK_EQUAL(record.expired_count, 1);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_disarmed_deadline_does_not_expire) {
+		// set up
+		boost::asio::io_context io_context;
+		const auto wheel = std::make_shared<timer_wheel>(io_context.get_executor(), 5ms);
+		expiry_record record;
+		auto deadline = make_deadline(record);
+		wheel->arm(deadline, 10ms);
+
+		// exercise
+		wheel->disarm(deadline);
+		io_context.run_for(50ms);
+
+		// verify
+		BOOST_CHECK_EQUAL(record.expired_count, 0);
+		BOOST_CHECK(!deadline.is_armed());
+		BOOST_CHECK_EQUAL(wheel->armed_count(), 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_rearm_replaces_previous_deadline) {
+		// set up
+		boost::asio::io_context io_context;
+		const auto wheel = std::make_shared<timer_wheel>(io_context.get_executor(), 5ms);
+		expiry_record record;
+		auto deadline = make_deadline(record);
+		const auto armed_time = clock::now();
+		wheel->arm(deadline, 10ms);
+
+		// exercise
+		wheel->arm(deadline, 80ms);
+		io_context.run_for(2s);
+
+		// verify
+		BOOST_REQUIRE(record.expired_time.has_value());
+		BOOST_CHECK(*record.expired_time - armed_time >= 80ms);
+		BOOST_CHECK_EQUAL(record.expired_count, 1);
+		BOOST_CHECK_EQUAL(wheel->armed_count(), 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_destroyed_deadline_is_disarmed) {
+		// set up
+		boost::asio::io_context io_context;
+		const auto wheel = std::make_shared<timer_wheel>(io_context.get_executor(), 5ms);
+		expiry_record record;
+
+		// exercise
+		{
+			auto deadline = make_deadline(record);
+			wheel->arm(deadline, 10ms);
+		}
+		io_context.run_for(50ms);
+
+		// verify
+		BOOST_CHECK_EQUAL(record.expired_count, 0);
+		BOOST_CHECK_EQUAL(wheel->armed_count(), 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_deadline_guard_disarms_on_destruction) {
+		// set up
+		boost::asio::io_context io_context;
+		const auto wheel = std::make_shared<timer_wheel>(io_context.get_executor(), 5ms);
+		expiry_record record;
+		auto deadline = make_deadline(record);
+
+		// exercise
+		{
+			const timer_wheel_deadline_guard guard(*wheel, deadline, 10ms);
+			BOOST_CHECK(deadline.is_armed());
+		}
+		io_context.run_for(50ms);
+
+		// verify
+		BOOST_CHECK_EQUAL(record.expired_count, 0);
+		BOOST_CHECK(!deadline.is_armed());
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,27 @@
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/server/tls_handshake_pool.hpp"
+
+using namespace pgl;
+
+BOOST_AUTO_TEST_SUITE(tls_handshake_pool_test)
+
+	BOOST_AUTO_TEST_CASE(test_constructor_throws_for_invalid_parameters) {
+		// exercise & verify
+		BOOST_CHECK_THROW(tls_handshake_pool(0, 1), std::invalid_argument);
+		BOOST_CHECK_THROW(tls_handshake_pool(1, 0), std::invalid_argument);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_new_pool_has_no_pending_handshake) {
+		// set up & exercise
+		const tls_handshake_pool pool(2, 4);
+
+		// verify
+		BOOST_CHECK_EQUAL(pool.pending_handshake_count(), 0);
+		BOOST_CHECK_EQUAL(pool.peak_pending_handshake_count(), 0);
+		BOOST_CHECK_EQUAL(pool.refused_handshake_count(), 0);
+	}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include "../../PlanetaMatchMakerServer/source/server/tls_session_ticket_keys.hpp"
+
+using namespace pgl;
+using namespace std::chrono_literals;
+
+BOOST_AUTO_TEST_SUITE(tls_session_ticket_keys_test)
+
+	BOOST_AUTO_TEST_CASE(test_constructor_throws_for_non_positive_rotation_interval) {
+		// exercise & verify
+		BOOST_CHECK_THROW(tls_session_ticket_keys(0s), std::invalid_argument);
+		BOOST_CHECK_THROW(tls_session_ticket_keys(-1s), std::invalid_argument);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_encryption_key_is_kept_within_rotation_interval) {
+		// set up
+		tls_session_ticket_keys keys(1h);
+
+		// exercise
+		const auto first_key = keys.encryption_key();
+		const auto second_key = keys.encryption_key();
+
+		// verify
+		BOOST_CHECK(first_key.name == second_key.name);
+		BOOST_CHECK(first_key.aes_key == second_key.aes_key);
+		BOOST_CHECK(first_key.hmac_key == second_key.hmac_key);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_find_decryption_key_finds_current_key) {
+		// set up
+		tls_session_ticket_keys keys(1h);
+		const auto encryption_key = keys.encryption_key();
+
+		// exercise
+		const auto found_key = keys.find_decryption_key(encryption_key.name);
+
+		// verify
+		BOOST_REQUIRE(found_key.has_value());
+		BOOST_CHECK(found_key->first.aes_key == encryption_key.aes_key);
+		BOOST_CHECK(found_key->second);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_find_decryption_key_returns_nullopt_for_unknown_name) {
+		// set up
+		tls_session_ticket_keys keys(1h);
+		auto name = keys.encryption_key().name;
+		++name[0];
+
+		// exercise & verify
+		BOOST_CHECK(!keys.find_decryption_key(name).has_value());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_previous_key_decrypts_until_next_rotation) {
+		// set up
+		tls_session_ticket_keys keys(50ms);
+		const auto old_key = keys.encryption_key();
+
+		// exercise
+		std::this_thread::sleep_for(60ms);
+		const auto new_key = keys.encryption_key();
+		const auto found_old_key = keys.find_decryption_key(old_key.name);
+
+		// verify
+		BOOST_CHECK(new_key.name != old_key.name);
+		BOOST_REQUIRE(found_old_key.has_value());
+		BOOST_CHECK(!found_old_key->second);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_key_older_than_two_intervals_expires) {
+		// set up
+		tls_session_ticket_keys keys(20ms);
+		const auto old_key = keys.encryption_key();
+
+		// exercise
+		std::this_thread::sleep_for(50ms);
+		const auto found_old_key = keys.find_decryption_key(old_key.name);
+
+		// verify
+		BOOST_CHECK(!found_old_key.has_value());
+	}
+
+BOOST_AUTO_TEST_SUITE_END()